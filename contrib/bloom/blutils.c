@@ -131,6 +131,7 @@ blhandler(PG_FUNCTION_ARGS)
 
 		.ambuild = blbuild,
 		.ambuildempty = blbuildempty,
+		.ambuildparallelok = NULL,
 		.aminsert = blinsert,
 		.aminsertcleanup = NULL,
 		.ambulkdelete = blbulkdelete,
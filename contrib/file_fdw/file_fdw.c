@@ -3,6 +3,13 @@
  * file_fdw.c
  *		  foreign-data wrapper for server-side flat files (or programs).
  *
+ * Files are read through COPY FROM, so parsing is the same as for COPY, and
+ * only columns the query needs are converted to datums (see
+ * check_selective_binary_conversion).  Scans are not parallel-aware: a
+ * worker starting at an arbitrary byte offset of a CSV file cannot tell
+ * whether a newline ends a line or sits inside a quoted field without
+ * reading the file from the start, and programs can't be split at all.
+ *
  * Copyright (c) 2010-2026, PostgreSQL Global Development Group
  *
  * IDENTIFICATION
@@ -33,6 +33,14 @@
  * requires holding pgss->lock exclusively; this allows individual entries
  * in the file to be read or written while holding only shared lock.
  *
+ * Garbage collection therefore blocks every backend that needs to create an
+ * entry, or even look one up, for as long as it takes to read and rewrite
+ * the file.  Keeping the texts in a DSA area instead would let entries free
+ * their text individually on eviction, avoiding the bulk rewrite, but would
+ * bring back the problems the external file was introduced to solve: the
+ * texts' total size would have to be bounded in advance, and long query
+ * strings would either be truncated or crowd out other entries.
+ *
  *
  * Copyright (c) 2008-2026, PostgreSQL Global Development Group
  *
@@ -150,6 +158,12 @@ typedef struct pgssHashKey
 
 /*
  * The actual stats counters kept within pgssEntry.
+ *
+ * Timing is summarized by min/max/mean/stddev, which Welford's method lets
+ * us maintain in constant space.  Percentiles would need a histogram per
+ * entry and kind; even a coarse log-linear one of a few dozen buckets would
+ * several times enlarge each of the pg_stat_statements.max entries in shared
+ * memory, as well as the dump file written at shutdown.
  */
 typedef struct Counters
 {
@@ -184,6 +184,13 @@ commit;
 select * from pg_visibility_map('copyfreeze');
 select * from pg_check_frozen('copyfreeze');
 
+-- CREATE MATERIALIZED VIEW inserts its rows frozen, like REFRESH does, so
+-- all of its pages should be set all-visible and all-frozen right away.
+create materialized view matview_frozen as
+  select a, a::text::char(1500) as b from generate_series(1, 6) a;
+select * from pg_visibility_map('matview_frozen');
+select * from pg_check_frozen('matview_frozen');
+
 -- cleanup
 drop table test_partitioned;
 drop view test_view;
@@ -192,5 +199,6 @@ drop foreign table test_foreign_table;
 drop server dummy_server;
 drop foreign data wrapper dummy;
 drop materialized view matview_visibility_test;
+drop materialized view matview_frozen;
 drop table regular_table;
 drop table copyfreeze;
@@ -705,6 +705,15 @@ postgres_fdw_handler(PG_FUNCTION_ARGS)
 	routine->ForeignAsyncConfigureWait = postgresForeignAsyncConfigureWait;
 	routine->ForeignAsyncNotify = postgresForeignAsyncNotify;
 
+	/*
+	 * We don't provide IsForeignScanParallelSafe or the DSM callbacks, so
+	 * foreign scans always run in the leader.  Workers would each need their
+	 * own remote connection importing a snapshot exported by the leader's
+	 * remote transaction, and each would read only its own part of the
+	 * table.  Remote transactions are only ever tied to local
+	 * subtransactions within a single backend (see connection.c).
+	 */
+
 	PG_RETURN_POINTER(routine);
 }
 
@@ -1738,6 +1747,13 @@ postgresIterateForeignScan(ForeignScanState *node)
 /*
  * postgresReScanForeignScan
  *		Restart the scan.
+ *
+ * For a parameterized scan on the inner side of a nestloop, this runs once
+ * per outer row, and each run costs a round trip to the remote server.
+ * Batching outer rows into a single remote query (using "= ANY($1)" and
+ * matching the results back to the outer rows) would have to be done by
+ * the join, not here: the executor hands us a single set of parameter
+ * values per rescan and expects only the matching rows in return.
  */
 static void
 postgresReScanForeignScan(ForeignScanState *node)
@@ -283,6 +283,7 @@ brinhandler(PG_FUNCTION_ARGS)
 
 		.ambuild = brinbuild,
 		.ambuildempty = brinbuildempty,
+		.ambuildparallelok = NULL,
 		.aminsert = brininsert,
 		.aminsertcleanup = brininsertcleanup,
 		.ambulkdelete = brinbulkdelete,
@@ -343,7 +344,14 @@ initialize_brin_insertstate(Relation idxRel, IndexInfo *indexInfo)
  * page range.
  *
  * If the range is not currently summarized (i.e. the revmap returns NULL for
- * it), there's nothing to do for this tuple.
+ * it), there's nothing to do for this tuple.  We can't start a summary for
+ * the range here with just this tuple's values, since other pages of the
+ * range may already contain tuples (the heap may have been extended by
+ * several pages at once, and other backends may be inserting into them
+ * concurrently); a correct summary requires scanning the whole range with
+ * the placeholder-tuple protocol used by summarize_range().  That is why the
+ * newest range of a table stays unsummarized until autosummarization or
+ * VACUUM gets to it.
  */
 bool
 brininsert(Relation idxRel, Datum *values, bool *nulls,
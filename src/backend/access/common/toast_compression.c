@@ -16,6 +16,9 @@
 #ifdef USE_LZ4
 #include <lz4.h>
 #endif
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
 
 #include "access/detoast.h"
 #include "access/toast_compression.h"
@@ -245,6 +248,138 @@ lz4_decompress_datum_slice(const varlena *value, int32 slicelength)
 #endif
 }
 
+/*
+ * Compress a varlena using ZSTD.
+ *
+ * Returns the compressed varlena, or NULL if compression fails.
+ */
+varlena *
+zstd_compress_datum(const varlena *value)
+{
+#ifndef USE_ZSTD
+	NO_COMPRESSION_SUPPORT("zstd");
+	return NULL;				/* keep compiler quiet */
+#else
+	int32		valsize;
+	size_t		len;
+	size_t		max_size;
+	varlena    *tmp = NULL;
+
+	valsize = VARSIZE_ANY_EXHDR(value);
+
+	/*
+	 * Figure out the maximum possible size of the ZSTD output, add the bytes
+	 * that will be needed for varlena overhead, and allocate that amount.
+	 */
+	max_size = ZSTD_compressBound(valsize);
+	tmp = (varlena *) palloc(max_size + VARHDRSZ_COMPRESSED);
+
+	len = ZSTD_compress((char *) tmp + VARHDRSZ_COMPRESSED, max_size,
+						VARDATA_ANY(value), valsize,
+						ZSTD_CLEVEL_DEFAULT);
+	if (ZSTD_isError(len))
+		elog(ERROR, "zstd compression failed: %s", ZSTD_getErrorName(len));
+
+	/* data is incompressible so just free the memory and return NULL */
+	if (len > valsize)
+	{
+		pfree(tmp);
+		return NULL;
+	}
+
+	SET_VARSIZE_COMPRESSED(tmp, len + VARHDRSZ_COMPRESSED);
+
+	return tmp;
+#endif
+}
+
+/*
+ * Decompress a varlena that was compressed using ZSTD.
+ */
+varlena *
+zstd_decompress_datum(const varlena *value)
+{
+#ifndef USE_ZSTD
+	NO_COMPRESSION_SUPPORT("zstd");
+	return NULL;				/* keep compiler quiet */
+#else
+	size_t		rawsize;
+	varlena    *result;
+
+	/* allocate memory for the uncompressed data */
+	result = (varlena *) palloc(VARDATA_COMPRESSED_GET_EXTSIZE(value) + VARHDRSZ);
+
+	/* decompress the data */
+	rawsize = ZSTD_decompress(VARDATA(result),
+							  VARDATA_COMPRESSED_GET_EXTSIZE(value),
+							  (const char *) value + VARHDRSZ_COMPRESSED,
+							  VARSIZE(value) - VARHDRSZ_COMPRESSED);
+	if (ZSTD_isError(rawsize))
+		ereport(ERROR,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg_internal("compressed zstd data is corrupt")));
+
+	SET_VARSIZE(result, rawsize + VARHDRSZ);
+
+	return result;
+#endif
+}
+
+/*
+ * Decompress part of a varlena that was compressed using ZSTD.
+ *
+ * ZSTD has no one-shot partial decompression, so we use the streaming API
+ * and stop as soon as the output buffer is full.
+ */
+varlena *
+zstd_decompress_datum_slice(const varlena *value, int32 slicelength)
+{
+#ifndef USE_ZSTD
+	NO_COMPRESSION_SUPPORT("zstd");
+	return NULL;				/* keep compiler quiet */
+#else
+	varlena    *result;
+	ZSTD_DCtx  *dctx;
+	ZSTD_inBuffer input;
+	ZSTD_outBuffer output;
+	size_t		ret = 0;
+
+	/* allocate memory for the uncompressed data */
+	result = (varlena *) palloc(slicelength + VARHDRSZ);
+
+	dctx = ZSTD_createDCtx();
+	if (dctx == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("out of memory")));
+
+	input.src = (const char *) value + VARHDRSZ_COMPRESSED;
+	input.size = VARSIZE(value) - VARHDRSZ_COMPRESSED;
+	input.pos = 0;
+	output.dst = VARDATA(result);
+	output.size = slicelength;
+	output.pos = 0;
+
+	while (output.pos < output.size && input.pos < input.size)
+	{
+		ret = ZSTD_decompressStream(dctx, &output, &input);
+		if (ZSTD_isError(ret) || ret == 0)
+			break;
+	}
+
+	ZSTD_freeDCtx(dctx);
+
+	if (ZSTD_isError(ret))
+		ereport(ERROR,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg_internal("compressed zstd data is corrupt")));
+
+	SET_VARSIZE(result, output.pos + VARHDRSZ);
+
+	return result;
+#endif
+}
+
 /*
  * Extract compression ID from a varlena.
  *
@@ -293,6 +428,13 @@ CompressionNameToMethod(const char *compression)
 #endif
 		return TOAST_LZ4_COMPRESSION;
 	}
+	else if (strcmp(compression, "zstd") == 0)
+	{
+#ifndef USE_ZSTD
+		NO_COMPRESSION_SUPPORT("zstd");
+#endif
+		return TOAST_ZSTD_COMPRESSION;
+	}
 
 	return InvalidCompressionMethod;
 }
@@ -309,6 +451,8 @@ GetCompressionMethodName(char method)
 			return "pglz";
 		case TOAST_LZ4_COMPRESSION:
 			return "lz4";
+		case TOAST_ZSTD_COMPRESSION:
+			return "zstd";
 		default:
 			elog(ERROR, "invalid compression method %c", method);
 			return NULL;		/* keep compiler quiet */
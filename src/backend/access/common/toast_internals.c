@@ -71,6 +71,10 @@ toast_compress_datum(Datum value, char cmethod)
 			tmp = lz4_compress_datum((const varlena *) DatumGetPointer(value));
 			cmid = TOAST_LZ4_COMPRESSION_ID;
 			break;
+		case TOAST_ZSTD_COMPRESSION:
+			tmp = zstd_compress_datum((const varlena *) DatumGetPointer(value));
+			cmid = TOAST_ZSTD_COMPRESSION_ID;
+			break;
 		default:
 			elog(ERROR, "invalid compression method %c", cmethod);
 	}
@@ -113,6 +117,15 @@ toast_compress_datum(Datum value, char cmethod)
  * value: datum to be pushed to toast storage
  * oldexternal: if not NULL, toast pointer previously representing the datum
  * options: options to be passed to heap_insert() for toast rows
+ *
+ * A modified value is always saved in full under a new value OID, even if
+ * only a few bytes changed; the old value's chunks are deleted separately by
+ * the caller.  Reusing unchanged chunks of the old value would require that
+ * the toast pointer be able to refer to chunks belonging to more than one
+ * value (or that chunk rows be shared between values, with their own
+ * visibility and cleanup rules), and it would only help for uncompressed
+ * values, since a change anywhere in a compressed value generally changes
+ * all of its compressed bytes from that point on.
  * ----------
  */
 Datum
@@ -775,6 +775,11 @@ processPendingPage(BuildAccumulator *accum, KeyArray *ka,
  * FSM.
  *
  * If stats isn't null, we count deleted pending pages into the counts.
+ *
+ * When called from a regular insert (!forceCleanup), we stop after the first
+ * batch of pending pages has been moved into the main structure, so that
+ * the cost of cleaning up a large pending list is spread across subsequent
+ * inserts and vacuum instead of being paid by a single unlucky inserter.
  */
 void
 ginInsertCleanup(GinState *ginstate, bool full_clean,
@@ -981,9 +986,11 @@ ginInsertCleanup(GinState *ginstate, bool full_clean,
 
 			/*
 			 * if we removed the whole pending list or we cleanup tail (which
-			 * we remembered on start our cleanup process) then just exit
+			 * we remembered on start our cleanup process) then just exit.
+			 * A regular inserter also exits here, having done its share; the
+			 * next insert that finds the list too long will continue.
 			 */
-			if (blkno == InvalidBlockNumber || cleanupFinish)
+			if (blkno == InvalidBlockNumber || cleanupFinish || !forceCleanup)
 				break;
 
 			/*
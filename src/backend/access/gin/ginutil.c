@@ -68,6 +68,7 @@ ginhandler(PG_FUNCTION_ARGS)
 
 		.ambuild = ginbuild,
 		.ambuildempty = ginbuildempty,
+		.ambuildparallelok = NULL,
 		.aminsert = gininsert,
 		.aminsertcleanup = NULL,
 		.ambulkdelete = ginbulkdelete,
@@ -77,8 +77,8 @@ gisthandler(PG_FUNCTION_ARGS)
 		.amstorage = true,
 		.amclusterable = true,
 		.ampredlocks = true,
-		.amcanparallel = false,
-		.amcanbuildparallel = false,
+		.amcanparallel = true,
+		.amcanbuildparallel = true,
 		.amcaninclude = true,
 		.amusemaintenanceworkmem = false,
 		.amsummarizing = false,
@@ -88,6 +88,7 @@ gisthandler(PG_FUNCTION_ARGS)
 
 		.ambuild = gistbuild,
 		.ambuildempty = gistbuildempty,
+		.ambuildparallelok = gistbuildparallelok,
 		.aminsert = gistinsert,
 		.aminsertcleanup = NULL,
 		.ambulkdelete = gistbulkdelete,
@@ -107,9 +108,9 @@ gisthandler(PG_FUNCTION_ARGS)
 		.amendscan = gistendscan,
 		.ammarkpos = NULL,
 		.amrestrpos = NULL,
-		.amestimateparallelscan = NULL,
-		.aminitparallelscan = NULL,
-		.amparallelrescan = NULL,
+		.amestimateparallelscan = gistestimateparallelscan,
+		.aminitparallelscan = gistinitparallelscan,
+		.amparallelrescan = gistparallelrescan,
 		.amtranslatestrategy = NULL,
 		.amtranslatecmptype = gisttranslatecmptype,
 	};
@@ -14,6 +14,9 @@
  *
  * The sorted method is used if the operator classes for all columns have
  * a 'sortsupport' defined. Otherwise, we resort to the second strategy.
+ * The sorted method can scan the table and sort the tuples using parallel
+ * workers, like a B-tree build does; the index pages are then written by
+ * the leader from the merged sort output.
  *
  * The second strategy can optionally use buffers at different levels of
  * the tree to reduce I/O, see "Buffering build algorithm" in the README
@@ -36,17 +39,37 @@
 
 #include "access/genam.h"
 #include "access/gist_private.h"
+#include "access/parallel.h"
+#include "access/table.h"
 #include "access/tableam.h"
 #include "access/xloginsert.h"
+#include "catalog/index.h"
+#include "executor/instrument.h"
 #include "miscadmin.h"
 #include "nodes/execnodes.h"
 #include "optimizer/optimizer.h"
+#include "pgstat.h"
 #include "storage/bufmgr.h"
 #include "storage/bulk_write.h"
-
+#include "storage/proc.h"
+#include "tcop/tcopprot.h"
 #include "utils/memutils.h"
 #include "utils/rel.h"
 #include "utils/tuplesort.h"
+#include "utils/wait_event.h"
+
+/* Magic numbers for parallel state sharing */
+#define PARALLEL_KEY_GIST_SHARED		UINT64CONST(0xC000000000000001)
+#define PARALLEL_KEY_TUPLESORT			UINT64CONST(0xC000000000000002)
+#define PARALLEL_KEY_QUERY_TEXT			UINT64CONST(0xC000000000000003)
+#define PARALLEL_KEY_WAL_USAGE			UINT64CONST(0xC000000000000004)
+#define PARALLEL_KEY_BUFFER_USAGE		UINT64CONST(0xC000000000000005)
+
+/*
+ * DISABLE_LEADER_PARTICIPATION disables the leader's participation in
+ * parallel index builds.  This may be useful as a debugging aid.
+ */
+/* #define DISABLE_LEADER_PARTICIPATION */
 
 /* Step of index tuples for check whether to switch to buffering build mode */
 #define BUFFERING_MODE_SWITCH_CHECK_STEP 256
@@ -78,6 +101,98 @@ typedef enum
 	GIST_BUFFERING_ACTIVE,		/* in buffering build mode */
 } GistBuildMode;
 
+/*
+ * Status for sorted index builds performed in parallel.  This is allocated in
+ * a dynamic shared memory segment.  Note that there is a separate tuplesort
+ * TOC entry, private to tuplesort.c but allocated by this module on its
+ * behalf.
+ */
+typedef struct GISTBuildShared
+{
+	/*
+	 * These fields are not modified during the sort.  They primarily exist
+	 * for the benefit of worker processes that need to create state
+	 * corresponding to that used by the leader.
+	 */
+	Oid			heaprelid;
+	Oid			indexrelid;
+	bool		isconcurrent;
+	int			scantuplesortstates;
+
+	/*
+	 * workersdonecv is used to monitor the progress of workers.  All parallel
+	 * participants must indicate that they are done before leader can use
+	 * mutable state that workers maintain during scan (and before leader can
+	 * proceed to tuplesort_performsort()).
+	 */
+	ConditionVariable workersdonecv;
+
+	/*
+	 * mutex protects all following fields
+	 *
+	 * nparticipantsdone is number of worker processes finished.
+	 *
+	 * reltuples is the total number of input heap tuples.
+	 *
+	 * indtuples is the total number of tuples that made it into the index.
+	 *
+	 * brokenhotchain indicates if any worker detected a broken HOT chain
+	 * during build.
+	 */
+	slock_t		mutex;
+	int			nparticipantsdone;
+	double		reltuples;
+	double		indtuples;
+	bool		brokenhotchain;
+
+	/*
+	 * ParallelTableScanDescData data follows. Can't directly embed here, as
+	 * implementations of the parallel table scan desc interface might need
+	 * stronger alignment.
+	 */
+} GISTBuildShared;
+
+/*
+ * Return pointer to a GISTBuildShared's parallel table scan.
+ *
+ * c.f. shm_toc_allocate as to why BUFFERALIGN is used, rather than just
+ * MAXALIGN.
+ */
+#define ParallelTableScanFromGISTBuildShared(shared) \
+	(ParallelTableScanDesc) ((char *) (shared) + BUFFERALIGN(sizeof(GISTBuildShared)))
+
+/*
+ * Status for leader in parallel index build.
+ */
+typedef struct GISTLeader
+{
+	/* parallel context itself */
+	ParallelContext *pcxt;
+
+	/*
+	 * nparticipanttuplesorts is the exact number of worker processes
+	 * successfully launched, plus one leader process if it participates as a
+	 * worker (only DISABLE_LEADER_PARTICIPATION builds avoid leader
+	 * participating as a worker).
+	 */
+	int			nparticipanttuplesorts;
+
+	/*
+	 * Leader process convenience pointers to shared state (leader avoids TOC
+	 * lookups).
+	 *
+	 * gistshared is the shared state for entire build.  sharedsort is the
+	 * shared, tuplesort-managed state passed to each process tuplesort.
+	 * snapshot is the snapshot used by the scan iff an MVCC snapshot is
+	 * required.
+	 */
+	GISTBuildShared *gistshared;
+	Sharedsort *sharedsort;
+	Snapshot	snapshot;
+	WalUsage   *walusage;
+	BufferUsage *bufferusage;
+} GISTLeader;
+
 /* Working state for gistbuild and its callback */
 typedef struct
 {
@@ -105,6 +220,12 @@ typedef struct
 	 */
 	Tuplesortstate *sortstate;	/* state data for tuplesort.c */
 
+	/*
+	 * gistleader is only present when a parallel sorted build is performed,
+	 * and only in the leader process.
+	 */
+	GISTLeader *gistleader;
+
 	BlockNumber pages_allocated;
 
 	BulkWriteState *bulkstate;
@@ -140,6 +261,18 @@ static void gist_indexsortbuild_levelstate_add(GISTBuildState *state,
 static void gist_indexsortbuild_levelstate_flush(GISTBuildState *state,
 												 GistSortedBuildLevelState *levelstate);
 
+static void _gist_begin_parallel(GISTBuildState *buildstate, bool isconcurrent,
+								 int request);
+static void _gist_end_parallel(GISTLeader *gistleader);
+static Size _gist_parallel_estimate_shared(Relation heap, Snapshot snapshot);
+static double _gist_parallel_heapscan(GISTBuildState *buildstate,
+									  bool *brokenhotchain);
+static void _gist_leader_participate_as_worker(GISTBuildState *buildstate);
+static void _gist_parallel_scan_and_sort(GISTBuildState *buildstate,
+										 GISTBuildShared *gistshared,
+										 Sharedsort *sharedsort,
+										 int sortmem, bool progress);
+
 static void gistInitBuffering(GISTBuildState *buildstate);
 static int	calculatePagesPerBuffer(GISTBuildState *buildstate, int levelStep);
 static void gistBuildCallback(Relation index,
@@ -170,8 +303,43 @@ static void gistMemorizeParent(GISTBuildState *buildstate, BlockNumber child,
 static void gistMemorizeAllDownlinks(GISTBuildState *buildstate,
 									 Buffer parentbuf);
 static BlockNumber gistGetParent(GISTBuildState *buildstate, BlockNumber child);
+static bool gistbuildwillsort(Relation index);
 
 
+/*
+ * Will gistbuild() use the sorted build method for this index?
+ *
+ * That's the case if buffering mode wasn't forced, and the operator classes
+ * of all key columns have a sortsupport function.
+ */
+static bool
+gistbuildwillsort(Relation index)
+{
+	GiSTOptions *options = (GiSTOptions *) index->rd_options;
+	int			keyscount = IndexRelationGetNumberOfKeyAttributes(index);
+
+	if (options && options->buffering_mode == GIST_OPTION_BUFFERING_ON)
+		return false;
+
+	for (int i = 0; i < keyscount; i++)
+	{
+		if (!OidIsValid(index_getprocid(index, i + 1, GIST_SORTSUPPORT_PROC)))
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * ambuildparallelok callback.  Only the sorted build method can use parallel
+ * workers, so don't let the planner ask for any otherwise.
+ */
+bool
+gistbuildparallelok(Relation index)
+{
+	return gistbuildwillsort(index);
+}
+
 /*
  * Main entry point to GiST index build.
  */
@@ -183,7 +351,6 @@ gistbuild(Relation heap, Relation index, IndexInfo *indexInfo)
 	GISTBuildState buildstate;
 	MemoryContext oldcxt = CurrentMemoryContext;
 	int			fillfactor;
-	Oid			SortSupportFnOids[INDEX_MAX_KEYS];
 	GiSTOptions *options = (GiSTOptions *) index->rd_options;
 
 	/*
@@ -197,6 +364,7 @@ gistbuild(Relation heap, Relation index, IndexInfo *indexInfo)
 	buildstate.indexrel = index;
 	buildstate.heaprel = heap;
 	buildstate.sortstate = NULL;
+	buildstate.gistleader = NULL;
 	buildstate.giststate = initGISTstate(index);
 
 	/*
@@ -228,24 +396,8 @@ gistbuild(Relation heap, Relation index, IndexInfo *indexInfo)
 	/*
 	 * Unless buffering mode was forced, see if we can use sorting instead.
 	 */
-	if (buildstate.buildMode != GIST_BUFFERING_STATS)
-	{
-		bool		hasallsortsupports = true;
-		int			keyscount = IndexRelationGetNumberOfKeyAttributes(index);
-
-		for (int i = 0; i < keyscount; i++)
-		{
-			SortSupportFnOids[i] = index_getprocid(index, i + 1,
-												   GIST_SORTSUPPORT_PROC);
-			if (!OidIsValid(SortSupportFnOids[i]))
-			{
-				hasallsortsupports = false;
-				break;
-			}
-		}
-		if (hasallsortsupports)
-			buildstate.buildMode = GIST_SORTED_BUILD;
-	}
+	if (gistbuildwillsort(index))
+		buildstate.buildMode = GIST_SORTED_BUILD;
 
 	/*
 	 * Calculate target amount of free space to leave on pages.
@@ -262,18 +414,53 @@ gistbuild(Relation heap, Relation index, IndexInfo *indexInfo)
 	if (buildstate.buildMode == GIST_SORTED_BUILD)
 	{
 		/*
-		 * Sort all data, build the index from bottom up.
+		 * Sort all data, build the index from bottom up.  Attempt to launch
+		 * parallel workers to scan the table and sort the tuples, if
+		 * requested.
 		 */
-		buildstate.sortstate = tuplesort_begin_index_gist(heap,
-														  index,
-														  maintenance_work_mem,
-														  NULL,
-														  TUPLESORT_NONE);
+		if (indexInfo->ii_ParallelWorkers > 0)
+			_gist_begin_parallel(&buildstate, indexInfo->ii_Concurrent,
+								 indexInfo->ii_ParallelWorkers);
 
-		/* Scan the table, adding all tuples to the tuplesort */
-		reltuples = table_index_build_scan(heap, index, indexInfo, true, true,
-										   gistSortedBuildCallback,
-										   &buildstate, NULL);
+		if (buildstate.gistleader)
+		{
+			SortCoordinate coordinate;
+			bool		brokenhotchain = false;
+
+			/*
+			 * Set up the leader's tuplesort, which merges the runs produced
+			 * by each participant, then wait for the workers to finish
+			 * scanning.
+			 */
+			coordinate = palloc0_object(SortCoordinateData);
+			coordinate->isWorker = false;
+			coordinate->nParticipants =
+				buildstate.gistleader->nparticipanttuplesorts;
+			coordinate->sharedsort = buildstate.gistleader->sharedsort;
+
+			buildstate.sortstate = tuplesort_begin_index_gist(heap,
+															  index,
+															  maintenance_work_mem,
+															  coordinate,
+															  TUPLESORT_NONE);
+
+			reltuples = _gist_parallel_heapscan(&buildstate, &brokenhotchain);
+			if (brokenhotchain)
+				indexInfo->ii_BrokenHotChain = true;
+		}
+		else
+		{
+			buildstate.sortstate = tuplesort_begin_index_gist(heap,
+															  index,
+															  maintenance_work_mem,
+															  NULL,
+															  TUPLESORT_NONE);
+
+			/* Scan the table, adding all tuples to the tuplesort */
+			reltuples = table_index_build_scan(heap, index, indexInfo, true, true,
+											   gistSortedBuildCallback,
+											   &buildstate, NULL);
+		}
 
 		/*
 		 * Perform the sort and build index pages.
@@ -283,6 +470,9 @@ gistbuild(Relation heap, Relation index, IndexInfo *indexInfo)
 		gist_indexsortbuild(&buildstate);
 
 		tuplesort_end(buildstate.sortstate);
+
+		if (buildstate.gistleader)
+			_gist_end_parallel(buildstate.gistleader);
 	}
 	else
 	{
@@ -609,6 +799,470 @@ gist_indexsortbuild_levelstate_flush(GISTBuildState *state,
 }
 
 
+/*-------------------------------------------------------------------------
+ * Routines for parallel sorted build
+ *-------------------------------------------------------------------------
+ */
+
+/*
+ * Create parallel context, and launch workers for leader.
+ *
+ * buildstate argument should be initialized (with the exception of the
+ * tuplesort state, which may later be created based on shared state
+ * initially set up here).
+ *
+ * isconcurrent indicates if operation is CREATE INDEX CONCURRENTLY.
+ *
+ * request is the target number of parallel worker processes to launch.
+ *
+ * Sets buildstate's GISTLeader, which caller must use to shut down parallel
+ * mode by passing it to _gist_end_parallel() at the very end of its index
+ * build.  If not even a single worker process can be launched, this is
+ * never set, and caller should proceed with a serial index build.
+ */
+static void
+_gist_begin_parallel(GISTBuildState *buildstate, bool isconcurrent,
+					 int request)
+{
+	Relation	heap = buildstate->heaprel;
+	Relation	index = buildstate->indexrel;
+	ParallelContext *pcxt;
+	int			scantuplesortstates;
+	Snapshot	snapshot;
+	Size		estgistshared;
+	Size		estsort;
+	GISTBuildShared *gistshared;
+	Sharedsort *sharedsort;
+	GISTLeader *gistleader = palloc0_object(GISTLeader);
+	WalUsage   *walusage;
+	BufferUsage *bufferusage;
+	bool		leaderparticipates = true;
+	int			querylen;
+
+#ifdef DISABLE_LEADER_PARTICIPATION
+	leaderparticipates = false;
+#endif
+
+	/*
+	 * Enter parallel mode, and create context for parallel build of gist
+	 * index
+	 */
+	EnterParallelMode();
+	Assert(request > 0);
+	pcxt = CreateParallelContext("postgres", "_gist_parallel_build_main",
+								 request);
+
+	scantuplesortstates = leaderparticipates ? request + 1 : request;
+
+	/*
+	 * Prepare for scan of the base relation.  In a normal index build, we use
+	 * SnapshotAny because we must retrieve all tuples and do our own time
+	 * qual checks (because we have to index RECENTLY_DEAD tuples).  In a
+	 * concurrent build, we take a regular MVCC snapshot and index whatever's
+	 * live according to that.
+	 */
+	if (!isconcurrent)
+		snapshot = SnapshotAny;
+	else
+		snapshot = RegisterSnapshot(GetTransactionSnapshot());
+
+	/*
+	 * Estimate size for our own PARALLEL_KEY_GIST_SHARED workspace, and
+	 * PARALLEL_KEY_TUPLESORT tuplesort workspace
+	 */
+	estgistshared = _gist_parallel_estimate_shared(heap, snapshot);
+	shm_toc_estimate_chunk(&pcxt->estimator, estgistshared);
+	estsort = tuplesort_estimate_shared(scantuplesortstates);
+	shm_toc_estimate_chunk(&pcxt->estimator, estsort);
+
+	shm_toc_estimate_keys(&pcxt->estimator, 2);
+
+	/*
+	 * Estimate space for WalUsage and BufferUsage -- PARALLEL_KEY_WAL_USAGE
+	 * and PARALLEL_KEY_BUFFER_USAGE.
+	 *
+	 * If there are no extensions loaded that care, we could skip this.  We
+	 * have no way of knowing whether anyone's looking at pgWalUsage or
+	 * pgBufferUsage, so do it unconditionally.
+	 */
+	shm_toc_estimate_chunk(&pcxt->estimator,
+						   mul_size(sizeof(WalUsage), pcxt->nworkers));
+	shm_toc_estimate_keys(&pcxt->estimator, 1);
+	shm_toc_estimate_chunk(&pcxt->estimator,
+						   mul_size(sizeof(BufferUsage), pcxt->nworkers));
+	shm_toc_estimate_keys(&pcxt->estimator, 1);
+
+	/* Finally, estimate PARALLEL_KEY_QUERY_TEXT space */
+	if (debug_query_string)
+	{
+		querylen = strlen(debug_query_string);
+		shm_toc_estimate_chunk(&pcxt->estimator, querylen + 1);
+		shm_toc_estimate_keys(&pcxt->estimator, 1);
+	}
+	else
+		querylen = 0;			/* keep compiler quiet */
+
+	/* Everyone's had a chance to ask for space, so now create the DSM */
+	InitializeParallelDSM(pcxt);
+
+	/* If no DSM segment was available, back out (do serial build) */
+	if (pcxt->seg == NULL)
+	{
+		if (IsMVCCSnapshot(snapshot))
+			UnregisterSnapshot(snapshot);
+		DestroyParallelContext(pcxt);
+		ExitParallelMode();
+		return;
+	}
+
+	/* Store shared build state, for which we reserved space */
+	gistshared = (GISTBuildShared *) shm_toc_allocate(pcxt->toc, estgistshared);
+	/* Initialize immutable state */
+	gistshared->heaprelid = RelationGetRelid(heap);
+	gistshared->indexrelid = RelationGetRelid(index);
+	gistshared->isconcurrent = isconcurrent;
+	gistshared->scantuplesortstates = scantuplesortstates;
+	ConditionVariableInit(&gistshared->workersdonecv);
+	SpinLockInit(&gistshared->mutex);
+	/* Initialize mutable state */
+	gistshared->nparticipantsdone = 0;
+	gistshared->reltuples = 0.0;
+	gistshared->indtuples = 0.0;
+	gistshared->brokenhotchain = false;
+	table_parallelscan_initialize(heap,
+								  ParallelTableScanFromGISTBuildShared(gistshared),
+								  snapshot);
+
+	/*
+	 * Store shared tuplesort-private state, for which we reserved space.
+	 * Then, initialize opaque state using tuplesort routine.
+	 */
+	sharedsort = (Sharedsort *) shm_toc_allocate(pcxt->toc, estsort);
+	tuplesort_initialize_shared(sharedsort, scantuplesortstates,
+								pcxt->seg);
+
+	shm_toc_insert(pcxt->toc, PARALLEL_KEY_GIST_SHARED, gistshared);
+	shm_toc_insert(pcxt->toc, PARALLEL_KEY_TUPLESORT, sharedsort);
+
+	/* Store query string for workers */
+	if (debug_query_string)
+	{
+		char	   *sharedquery;
+
+		sharedquery = (char *) shm_toc_allocate(pcxt->toc, querylen + 1);
+		memcpy(sharedquery, debug_query_string, querylen + 1);
+		shm_toc_insert(pcxt->toc, PARALLEL_KEY_QUERY_TEXT, sharedquery);
+	}
+
+	/*
+	 * Allocate space for each worker's WalUsage and BufferUsage; no need to
+	 * initialize.
+	 */
+	walusage = shm_toc_allocate(pcxt->toc,
+								mul_size(sizeof(WalUsage), pcxt->nworkers));
+	shm_toc_insert(pcxt->toc, PARALLEL_KEY_WAL_USAGE, walusage);
+	bufferusage = shm_toc_allocate(pcxt->toc,
+								   mul_size(sizeof(BufferUsage), pcxt->nworkers));
+	shm_toc_insert(pcxt->toc, PARALLEL_KEY_BUFFER_USAGE, bufferusage);
+
+	/* Launch workers, saving status for leader/caller */
+	LaunchParallelWorkers(pcxt);
+	gistleader->pcxt = pcxt;
+	gistleader->nparticipanttuplesorts = pcxt->nworkers_launched;
+	if (leaderparticipates)
+		gistleader->nparticipanttuplesorts++;
+	gistleader->gistshared = gistshared;
+	gistleader->sharedsort = sharedsort;
+	gistleader->snapshot = snapshot;
+	gistleader->walusage = walusage;
+	gistleader->bufferusage = bufferusage;
+
+	/* If no workers were successfully launched, back out (do serial build) */
+	if (pcxt->nworkers_launched == 0)
+	{
+		_gist_end_parallel(gistleader);
+		return;
+	}
+
+	/* Save leader state now that it's clear build will be parallel */
+	buildstate->gistleader = gistleader;
+
+	/* Join heap scan ourselves */
+	if (leaderparticipates)
+		_gist_leader_participate_as_worker(buildstate);
+
+	/*
+	 * Caller needs to wait for all launched workers when we return.  Make
+	 * sure that the failure-to-start case will not hang forever.
+	 */
+	WaitForParallelWorkersToAttach(pcxt);
+}
+
+/*
+ * Shut down workers, destroy parallel context, and end parallel mode.
+ */
+static void
+_gist_end_parallel(GISTLeader *gistleader)
+{
+	int			i;
+
+	/* Shutdown worker processes */
+	WaitForParallelWorkersToFinish(gistleader->pcxt);
+
+	/*
+	 * Next, accumulate WAL usage.  (This must wait for the workers to finish,
+	 * or we might get incomplete data.)
+	 */
+	for (i = 0; i < gistleader->pcxt->nworkers_launched; i++)
+		InstrAccumParallelQuery(&gistleader->bufferusage[i], &gistleader->walusage[i]);
+
+	/* Free last reference to MVCC snapshot, if one was used */
+	if (IsMVCCSnapshot(gistleader->snapshot))
+		UnregisterSnapshot(gistleader->snapshot);
+	DestroyParallelContext(gistleader->pcxt);
+	ExitParallelMode();
+}
+
+/*
+ * Returns size of shared memory required to store state for a parallel
+ * gist index build based on the snapshot its parallel scan will use.
+ */
+static Size
+_gist_parallel_estimate_shared(Relation heap, Snapshot snapshot)
+{
+	/* c.f. shm_toc_allocate as to why BUFFERALIGN is used */
+	return add_size(BUFFERALIGN(sizeof(GISTBuildShared)),
+					table_parallelscan_estimate(heap, snapshot));
+}
+
+/*
+ * Within leader, wait for end of heap scan.
+ *
+ * When called, parallel heap scan started by _gist_begin_parallel() will
+ * already be underway within worker processes (when leader participates
+ * as a worker, we should end up here just as workers are finishing).
+ *
+ * Fills in the number of index tuples for ambuild statistics, and lets
+ * caller set field indicating that some worker encountered a broken HOT
+ * chain.
+ *
+ * Returns the total number of heap tuples scanned.
+ */
+static double
+_gist_parallel_heapscan(GISTBuildState *buildstate, bool *brokenhotchain)
+{
+	GISTBuildShared *gistshared = buildstate->gistleader->gistshared;
+	int			nparticipanttuplesorts;
+	double		reltuples;
+
+	nparticipanttuplesorts = buildstate->gistleader->nparticipanttuplesorts;
+	for (;;)
+	{
+		SpinLockAcquire(&gistshared->mutex);
+		if (gistshared->nparticipantsdone == nparticipanttuplesorts)
+		{
+			buildstate->indtuples = (int64) gistshared->indtuples;
+			*brokenhotchain = gistshared->brokenhotchain;
+			reltuples = gistshared->reltuples;
+			SpinLockRelease(&gistshared->mutex);
+			break;
+		}
+		SpinLockRelease(&gistshared->mutex);
+
+		ConditionVariableSleep(&gistshared->workersdonecv,
+							   WAIT_EVENT_PARALLEL_CREATE_INDEX_SCAN);
+	}
+
+	ConditionVariableCancelSleep();
+
+	return reltuples;
+}
+
+/*
+ * Within leader, participate as a parallel worker.
+ */
+static void
+_gist_leader_participate_as_worker(GISTBuildState *buildstate)
+{
+	GISTLeader *gistleader = buildstate->gistleader;
+	GISTBuildState leaderworker;
+	int			sortmem;
+
+	/*
+	 * The leader's partial sort needs a tuplesort of its own, separate from
+	 * the one that will later merge all the participants' output, so work
+	 * on a copy of the build state.
+	 */
+	leaderworker = *buildstate;
+	leaderworker.sortstate = NULL;
+	leaderworker.gistleader = NULL;
+	leaderworker.indtuples = 0;
+
+	/*
+	 * Might as well use reliable figure when doling out maintenance_work_mem
+	 * (when requested number of workers were not launched, this will be
+	 * somewhat higher than it is for other workers).
+	 */
+	sortmem = maintenance_work_mem / gistleader->nparticipanttuplesorts;
+
+	/* Perform work common to all participants */
+	_gist_parallel_scan_and_sort(&leaderworker, gistleader->gistshared,
+								 gistleader->sharedsort, sortmem, true);
+}
+
+/*
+ * Perform work within a launched parallel process.
+ */
+void
+_gist_parallel_build_main(dsm_segment *seg, shm_toc *toc)
+{
+	char	   *sharedquery;
+	GISTBuildShared *gistshared;
+	Sharedsort *sharedsort;
+	GISTBuildState buildstate;
+	Relation	heapRel;
+	Relation	indexRel;
+	LOCKMODE	heapLockmode;
+	LOCKMODE	indexLockmode;
+	WalUsage   *walusage;
+	BufferUsage *bufferusage;
+	int			sortmem;
+
+	/*
+	 * The only possible status flag that can be set to the parallel worker is
+	 * PROC_IN_SAFE_IC.
+	 */
+	Assert((MyProc->statusFlags == 0) ||
+		   (MyProc->statusFlags == PROC_IN_SAFE_IC));
+
+	/* Set debug_query_string for individual workers first */
+	sharedquery = shm_toc_lookup(toc, PARALLEL_KEY_QUERY_TEXT, true);
+	debug_query_string = sharedquery;
+
+	/* Report the query string from leader */
+	pgstat_report_activity(STATE_RUNNING, debug_query_string);
+
+	/* Look up gist shared state */
+	gistshared = shm_toc_lookup(toc, PARALLEL_KEY_GIST_SHARED, false);
+
+	/* Open relations using lock modes known to be obtained by index.c */
+	if (!gistshared->isconcurrent)
+	{
+		heapLockmode = ShareLock;
+		indexLockmode = AccessExclusiveLock;
+	}
+	else
+	{
+		heapLockmode = ShareUpdateExclusiveLock;
+		indexLockmode = RowExclusiveLock;
+	}
+
+	/* Open relations within worker */
+	heapRel = table_open(gistshared->heaprelid, heapLockmode);
+	indexRel = index_open(gistshared->indexrelid, indexLockmode);
+
+	/* Initialize the worker's build state, enough for the sort callback */
+	memset(&buildstate, 0, sizeof(buildstate));
+	buildstate.indexrel = indexRel;
+	buildstate.heaprel = heapRel;
+	buildstate.giststate = initGISTstate(indexRel);
+	buildstate.giststate->tempCxt = createTempGistContext();
+	buildstate.buildMode = GIST_SORTED_BUILD;
+
+	/* Look up shared state private to tuplesort.c */
+	sharedsort = shm_toc_lookup(toc, PARALLEL_KEY_TUPLESORT, false);
+	tuplesort_attach_shared(sharedsort, seg);
+
+	/* Prepare to track buffer usage during parallel execution */
+	InstrStartParallelQuery();
+
+	/* Perform sorting of our part of the table */
+	sortmem = maintenance_work_mem / gistshared->scantuplesortstates;
+	_gist_parallel_scan_and_sort(&buildstate, gistshared, sharedsort,
+								 sortmem, false);
+
+	/* Report WAL/buffer usage during parallel execution */
+	bufferusage = shm_toc_lookup(toc, PARALLEL_KEY_BUFFER_USAGE, false);
+	walusage = shm_toc_lookup(toc, PARALLEL_KEY_WAL_USAGE, false);
+	InstrEndParallelQuery(&bufferusage[ParallelWorkerNumber],
+						  &walusage[ParallelWorkerNumber]);
+
+	MemoryContextDelete(buildstate.giststate->tempCxt);
+	freeGISTstate(buildstate.giststate);
+
+	index_close(indexRel, indexLockmode);
+	table_close(heapRel, heapLockmode);
+}
+
+/*
+ * Perform a worker's portion of a parallel sort.
+ *
+ * This generates a partial tuplesort for the passed build state, fed by this
+ * participant's share of a parallel heap scan.
+ *
+ * sortmem is the amount of working memory to use within each worker,
+ * expressed in KBs.
+ *
+ * When this returns, workers are done, and need only release resources.
+ */
+static void
+_gist_parallel_scan_and_sort(GISTBuildState *buildstate,
+							 GISTBuildShared *gistshared,
+							 Sharedsort *sharedsort,
+							 int sortmem, bool progress)
+{
+	SortCoordinate coordinate;
+	TableScanDesc scan;
+	double		reltuples;
+	IndexInfo  *indexInfo;
+
+	/* Initialize local tuplesort coordination state */
+	coordinate = palloc0_object(SortCoordinateData);
+	coordinate->isWorker = true;
+	coordinate->nParticipants = -1;
+	coordinate->sharedsort = sharedsort;
+
+	/* Begin "partial" tuplesort */
+	buildstate->sortstate = tuplesort_begin_index_gist(buildstate->heaprel,
+													   buildstate->indexrel,
+													   sortmem, coordinate,
+													   TUPLESORT_NONE);
+
+	/* Join parallel scan */
+	indexInfo = BuildIndexInfo(buildstate->indexrel);
+	indexInfo->ii_Concurrent = gistshared->isconcurrent;
+	scan = table_beginscan_parallel(buildstate->heaprel,
+									ParallelTableScanFromGISTBuildShared(gistshared),
+									SO_NONE);
+	reltuples = table_index_build_scan(buildstate->heaprel,
+									   buildstate->indexrel, indexInfo,
+									   true, progress,
+									   gistSortedBuildCallback,
+									   buildstate, scan);
+
+	/* Execute this worker's part of the sort */
+	tuplesort_performsort(buildstate->sortstate);
+
+	/*
+	 * Done.  Record ambuild statistics, and whether we encountered a broken
+	 * HOT chain.
+	 */
+	SpinLockAcquire(&gistshared->mutex);
+	gistshared->nparticipantsdone++;
+	gistshared->reltuples += reltuples;
+	gistshared->indtuples += buildstate->indtuples;
+	if (indexInfo->ii_BrokenHotChain)
+		gistshared->brokenhotchain = true;
+	SpinLockRelease(&gistshared->mutex);
+
+	/* Notify leader */
+	ConditionVariableSignal(&gistshared->workersdonecv);
+
+	/* We can end tuplesorts immediately */
+	tuplesort_end(buildstate->sortstate);
+	buildstate->sortstate = NULL;
+}
+
 /*-------------------------------------------------------------------------
  * Routines for non-sorted build
  *-------------------------------------------------------------------------
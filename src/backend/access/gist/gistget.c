@@ -25,6 +25,7 @@
 #include "utils/float.h"
 #include "utils/memutils.h"
 #include "utils/rel.h"
+#include "utils/wait_event.h"
 
 /*
  * gistkillitems() -- set LP_DEAD state for items an indexscan caller has
@@ -616,6 +617,117 @@ getNextNearest(IndexScanDesc scan)
 	return res;
 }
 
+/*
+ * Begin a parallel scan.
+ *
+ * The first participant to get here scans the root page.  Any leaf tuples
+ * on it are returned by that participant alone, while the downlinks it
+ * pushed into its queue are moved to shared memory so that every
+ * participant can claim them.  The others wait until that has been done.
+ */
+static void
+gistParallelScanRoot(IndexScanDesc scan)
+{
+	GISTScanOpaque so = (GISTScanOpaque) scan->opaque;
+	ParallelIndexScanDesc parallel_scan = scan->parallel_scan;
+	GISTParallelScanDesc gps;
+	GISTPS_State state;
+	GISTSearchItem fakeItem;
+	GistNSN		rootlsn = InvalidXLogRecPtr;
+	int			nchildren = 0;
+
+	gps = (GISTParallelScanDesc) OffsetToPointer(parallel_scan,
+												 parallel_scan->ps_offset_am);
+
+	for (;;)
+	{
+		SpinLockAcquire(&gps->gps_mutex);
+		state = gps->gps_state;
+		if (state == GISTPARALLEL_NOT_INITIALIZED)
+			gps->gps_state = GISTPARALLEL_ADVANCING;
+		SpinLockRelease(&gps->gps_mutex);
+
+		if (state != GISTPARALLEL_ADVANCING)
+			break;
+
+		ConditionVariableSleep(&gps->gps_cv, WAIT_EVENT_GIST_ROOT_PAGE);
+	}
+	ConditionVariableCancelSleep();
+
+	/* Somebody else already took care of the root page */
+	if (state == GISTPARALLEL_READY)
+		return;
+
+	fakeItem.blkno = GIST_ROOT_BLKNO;
+	memset(&fakeItem.data.parentlsn, 0, sizeof(GistNSN));
+	gistScanPage(scan, &fakeItem, NULL, NULL, NULL);
+
+	/*
+	 * All the items in the queue are downlinks from the root page, since
+	 * ordered scans are never parallel.  Nobody else looks at the shared
+	 * array until we set the state to READY, so no lock is needed to fill it.
+	 */
+	while (!pairingheap_is_empty(so->queue))
+	{
+		GISTSearchItem *item;
+
+		item = (GISTSearchItem *) pairingheap_remove_first(so->queue);
+		Assert(!GISTSearchItemIsHeap(*item));
+		Assert(nchildren < MaxIndexTuplesPerPage);
+		gps->gps_children[nchildren++] = item->blkno;
+		rootlsn = item->data.parentlsn;
+		pfree(item);
+	}
+
+	SpinLockAcquire(&gps->gps_mutex);
+	gps->gps_rootlsn = rootlsn;
+	gps->gps_nchildren = nchildren;
+	gps->gps_nextchild = 0;
+	gps->gps_state = GISTPARALLEL_READY;
+	SpinLockRelease(&gps->gps_mutex);
+
+	ConditionVariableBroadcast(&gps->gps_cv);
+}
+
+/*
+ * Claim the next unvisited subtree of the root page in a parallel scan.
+ *
+ * Returns a GISTSearchItem for the subtree's top page, or NULL when all of
+ * them have been claimed.  Caller must pfree item when done with it.
+ */
+static GISTSearchItem *
+gistParallelNextItem(IndexScanDesc scan)
+{
+	GISTScanOpaque so = (GISTScanOpaque) scan->opaque;
+	ParallelIndexScanDesc parallel_scan = scan->parallel_scan;
+	GISTParallelScanDesc gps;
+	GISTSearchItem *item;
+	BlockNumber blkno = InvalidBlockNumber;
+	GistNSN		rootlsn = InvalidXLogRecPtr;
+
+	gps = (GISTParallelScanDesc) OffsetToPointer(parallel_scan,
+												 parallel_scan->ps_offset_am);
+
+	SpinLockAcquire(&gps->gps_mutex);
+	Assert(gps->gps_state == GISTPARALLEL_READY);
+	if (gps->gps_nextchild < gps->gps_nchildren)
+	{
+		blkno = gps->gps_children[gps->gps_nextchild++];
+		rootlsn = gps->gps_rootlsn;
+	}
+	SpinLockRelease(&gps->gps_mutex);
+
+	if (!BlockNumberIsValid(blkno))
+		return NULL;
+
+	item = MemoryContextAlloc(so->queueCxt,
+							  SizeOfGISTSearchItem(scan->numberOfOrderBys));
+	item->blkno = blkno;
+	item->data.parentlsn = rootlsn;
+
+	return item;
+}
+
 /*
  * gistgettuple() -- Get the next tuple in the scan
  */
@@ -645,9 +757,23 @@ gistgettuple(IndexScanDesc scan, ScanDirection dir)
 		if (so->pageDataCxt)
 			MemoryContextReset(so->pageDataCxt);
 
-		fakeItem.blkno = GIST_ROOT_BLKNO;
-		memset(&fakeItem.data.parentlsn, 0, sizeof(GistNSN));
-		gistScanPage(scan, &fakeItem, NULL, NULL, NULL);
+		if (scan->parallel_scan)
+		{
+			/*
+			 * Each participant returns tuples in distance order only for the
+			 * subtrees it visits, so the planner never hands us this.
+			 */
+			if (scan->numberOfOrderBys > 0)
+				elog(ERROR, "GiST does not support parallel ordered scans");
+
+			gistParallelScanRoot(scan);
+		}
+		else
+		{
+			fakeItem.blkno = GIST_ROOT_BLKNO;
+			memset(&fakeItem.data.parentlsn, 0, sizeof(GistNSN));
+			gistScanPage(scan, &fakeItem, NULL, NULL, NULL);
+		}
 	}
 
 	if (scan->numberOfOrderBys > 0)
@@ -727,6 +853,10 @@ gistgettuple(IndexScanDesc scan, ScanDirection dir)
 
 				item = getNextGISTSearchItem(so);
 
+				/* in a parallel scan, move on to the next unclaimed subtree */
+				if (!item && scan->parallel_scan)
+					item = gistParallelNextItem(scan);
+
 				if (!item)
 					return false;
 
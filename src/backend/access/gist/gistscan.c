@@ -355,3 +355,53 @@ gistendscan(IndexScanDesc scan)
 	 */
 	freeGISTstate(so->giststate);
 }
+
+/*
+ * gistestimateparallelscan -- estimate storage for GISTParallelScanDescData
+ *
+ * We need room for one downlink per item the root page can hold.
+ */
+Size
+gistestimateparallelscan(Relation rel, int nkeys, int norderbys)
+{
+	return add_size(offsetof(GISTParallelScanDescData, gps_children),
+					mul_size(MaxIndexTuplesPerPage, sizeof(BlockNumber)));
+}
+
+/*
+ * gistinitparallelscan -- initialize GISTParallelScanDesc for parallel scan
+ */
+void
+gistinitparallelscan(void *target)
+{
+	GISTParallelScanDesc gps = (GISTParallelScanDesc) target;
+
+	SpinLockInit(&gps->gps_mutex);
+	gps->gps_state = GISTPARALLEL_NOT_INITIALIZED;
+	ConditionVariableInit(&gps->gps_cv);
+	gps->gps_rootlsn = InvalidXLogRecPtr;
+	gps->gps_nchildren = 0;
+	gps->gps_nextchild = 0;
+}
+
+/*
+ * gistparallelrescan -- reset parallel scan
+ */
+void
+gistparallelrescan(IndexScanDesc scan)
+{
+	ParallelIndexScanDesc parallel_scan = scan->parallel_scan;
+	GISTParallelScanDesc gps;
+
+	Assert(parallel_scan);
+
+	gps = (GISTParallelScanDesc) OffsetToPointer(parallel_scan,
+												 parallel_scan->ps_offset_am);
+
+	SpinLockAcquire(&gps->gps_mutex);
+	gps->gps_state = GISTPARALLEL_NOT_INITIALIZED;
+	gps->gps_rootlsn = InvalidXLogRecPtr;
+	gps->gps_nchildren = 0;
+	gps->gps_nextchild = 0;
+	SpinLockRelease(&gps->gps_mutex);
+}
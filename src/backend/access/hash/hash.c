@@ -99,6 +99,7 @@ hashhandler(PG_FUNCTION_ARGS)
 
 		.ambuild = hashbuild,
 		.ambuildempty = hashbuildempty,
+		.ambuildparallelok = NULL,
 		.aminsert = hashinsert,
 		.aminsertcleanup = NULL,
 		.ambulkdelete = hashbulkdelete,
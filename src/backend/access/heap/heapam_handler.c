@@ -1726,6 +1726,7 @@ heapam_index_validate_scan(Relation heapRelation,
 	ExprContext *econtext;
 	BlockNumber root_blkno = InvalidBlockNumber;
 	OffsetNumber root_offsets[MaxHeapTuplesPerPage];
+	bool		root_offsets_valid = false;
 	bool		in_index[MaxHeapTuplesPerPage];
 	BlockNumber previous_blkno = InvalidBlockNumber;
 
@@ -1805,17 +1806,17 @@ heapam_index_validate_scan(Relation heapRelation,
 		 * by keeping a bool array in_index[] showing all the
 		 * already-passed-over tuplesort output TIDs of the current page. We
 		 * clear that array here, when advancing onto a new heap page.
+		 *
+		 * The root offset map is only needed once we meet a heap-only tuple,
+		 * so build it lazily; many pages have none.  Our pin prevents
+		 * pruning, so building it later on the same page gives the same
+		 * answer for the tuples we can see.
 		 */
 		if (hscan->rs_cblock != root_blkno)
 		{
-			Page		page = BufferGetPage(hscan->rs_cbuf);
-
-			LockBuffer(hscan->rs_cbuf, BUFFER_LOCK_SHARE);
-			heap_get_root_tuples(page, root_offsets);
-			LockBuffer(hscan->rs_cbuf, BUFFER_LOCK_UNLOCK);
-
 			memset(in_index, 0, sizeof(in_index));
 
+			root_offsets_valid = false;
 			root_blkno = hscan->rs_cblock;
 		}
 
@@ -1825,6 +1826,17 @@ heapam_index_validate_scan(Relation heapRelation,
 
 		if (HeapTupleIsHeapOnly(heapTuple))
 		{
+			if (!root_offsets_valid)
+			{
+				Page		page = BufferGetPage(hscan->rs_cbuf);
+
+				LockBuffer(hscan->rs_cbuf, BUFFER_LOCK_SHARE);
+				heap_get_root_tuples(page, root_offsets);
+				LockBuffer(hscan->rs_cbuf, BUFFER_LOCK_UNLOCK);
+
+				root_offsets_valid = true;
+			}
+
 			root_offnum = root_offsets[root_offnum - 1];
 			if (!OffsetNumberIsValid(root_offnum))
 				ereport(ERROR,
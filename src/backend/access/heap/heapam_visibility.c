@@ -1682,7 +1682,10 @@ HeapTupleSatisfiesHistoricMVCC(HeapTuple htup, Snapshot snapshot,
  * avoids a cross-translation-unit function call for each tuple, allows the
  * compiler to optimize across calls to HeapTupleSatisfiesMVCC and allows
  * setting hint bits more efficiently (see the one BufferFinishSetHintBits()
- * call below).
+ * call below).  In addition, tuples whose xmin is hinted as committed and
+ * whose xmax is hinted as invalid, by far the most common case, are handled
+ * directly here, and the snapshot lookup for their xmin is shared between
+ * consecutive tuples inserted by the same transaction.
  *
  * Returns the number of visible tuples.
  */
@@ -1694,6 +1697,8 @@ HeapTupleSatisfiesMVCCBatch(Snapshot snapshot, Buffer buffer,
 {
 	int			nvis = 0;
 	SetHintBitsState state = SHB_INITIAL;
+	TransactionId last_xmin = InvalidTransactionId;
+	bool		last_xmin_visible = false;
 
 	Assert(IsMVCCSnapshot(snapshot));
 
@@ -1701,8 +1706,33 @@ HeapTupleSatisfiesMVCCBatch(Snapshot snapshot, Buffer buffer,
 	{
 		bool		valid;
 		HeapTuple	tup = &batchmvcc->tuples[i];
+		HeapTupleHeader tuple = tup->t_data;
 
-		valid = HeapTupleSatisfiesMVCC(tup, snapshot, buffer, &state);
+		if ((tuple->t_infomask & (HEAP_XMIN_COMMITTED | HEAP_XMAX_INVALID)) ==
+			(HEAP_XMIN_COMMITTED | HEAP_XMAX_INVALID))
+		{
+			/*
+			 * Same result HeapTupleSatisfiesMVCC() would produce: the
+			 * inserting transaction committed, and nobody deleted or locked
+			 * the tuple, so it's visible unless its xmin is still running
+			 * according to our snapshot.
+			 */
+			if (HeapTupleHeaderXminFrozen(tuple))
+				valid = true;
+			else
+			{
+				TransactionId xmin = HeapTupleHeaderGetRawXmin(tuple);
+
+				if (xmin != last_xmin)
+				{
+					last_xmin = xmin;
+					last_xmin_visible = !XidInMVCCSnapshot(xmin, snapshot);
+				}
+				valid = last_xmin_visible;
+			}
+		}
+		else
+			valid = HeapTupleSatisfiesMVCC(tup, snapshot, buffer, &state);
 		batchmvcc->visible[i] = valid;
 
 		if (likely(valid))
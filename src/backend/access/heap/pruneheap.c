@@ -250,6 +250,14 @@ static bool heap_page_will_set_vm(PruneState *prstate, PruneReason reason,
  * Note: this is called quite often.  It's important that it fall out quickly
  * if there's not any use in pruning.
  *
+ * Pruning is done here, by whichever backend happens to read the page,
+ * rather than deferred to a background process: the page is already pinned
+ * and in cache, pruning it is a page-local operation that is bounded in
+ * cost, and handing page numbers off to another process would mean that
+ * process reading the page again, likely after more dead tuples have piled
+ * up.  The cost to the reader is bounded by the cleanup lock being taken
+ * only conditionally.
+ *
  * Caller must have pin on the buffer, and must *not* have a lock on it.
  *
  * This function may pin *vmbuffer. It's passed by reference so the caller can
@@ -28,6 +28,18 @@
  * Manually invoked VACUUMs may scan indexes during phase II in parallel. For
  * more information on this, see the comment at the top of vacuumparallel.c.
  *
+ * Phases I and III always run in the leader.  Dividing them among workers by
+ * block range looks natural, since the TID store can already live in DSA and
+ * be shared, but it is more than handing out blocks: each worker would need
+ * its own copy of the pruning and freezing state (the cutoffs, NewRelfrozenXid
+ * and NewRelminMxid tracking, the eager scan bookkeeping), which the leader
+ * would then have to merge; phase I would have to be suspended in every
+ * participant when the shared TID store fills up; and vacuum truncation and
+ * the relation statistics rely on counters that are currently maintained by a
+ * single scan.  Until that is done, vacuum of a very large table is best
+ * helped by giving it enough memory that the TID store does not fill up, so
+ * that phases II and III are run only once.
+ *
  * In between phases, vacuum updates the freespace map (every
  * VACUUM_FSM_EVERY_PAGES).
  *
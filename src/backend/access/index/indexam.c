@@ -59,6 +59,10 @@
 #include "utils/snapmgr.h"
 #include "utils/syscache.h"
 
+static int	index_getbatch_cb(void *callback_private_data, BlockNumber blkno,
+							  ItemPointer tids, int maxtids);
+static void index_setup_batch_cb(IndexScanDesc scan);
+
 
 /* ----------------------------------------------------------------
  *					macros used in index_ routines
@@ -287,6 +291,7 @@ index_beginscan(Relation heapRelation,
 
 	/* prepare to fetch index matches from table */
 	scan->xs_heapfetch = table_index_fetch_begin(heapRelation, flags);
+	index_setup_batch_cb(scan);
 
 	return scan;
 }
@@ -584,6 +589,7 @@ index_beginscan_parallel(Relation heaprel, Relation indexrel,
 
 	/* prepare to fetch index matches from table */
 	scan->xs_heapfetch = table_index_fetch_begin(heaprel, flags);
+	index_setup_batch_cb(scan);
 
 	return scan;
 }
@@ -679,6 +685,32 @@ index_fetch_heap(IndexScanDesc scan, TupleTableSlot *slot)
 	return found;
 }
 
+/*
+ * Let the table AM see upcoming TIDs, if the index AM can tell us about them
+ */
+static void
+index_setup_batch_cb(IndexScanDesc scan)
+{
+	if (scan->indexRelation->rd_indam->amgetbatch != NULL)
+	{
+		scan->xs_heapfetch->batch_cb = index_getbatch_cb;
+		scan->xs_heapfetch->batch_cb_private_data = scan;
+	}
+}
+
+/*
+ * IndexFetchBatchCB callback used by table AMs, see amgetbatch
+ */
+static int
+index_getbatch_cb(void *callback_private_data, BlockNumber blkno,
+				  ItemPointer tids, int maxtids)
+{
+	IndexScanDesc scan = (IndexScanDesc) callback_private_data;
+
+	return scan->indexRelation->rd_indam->amgetbatch(scan, blkno,
+													 tids, maxtids);
+}
+
 /* ----------------
  *		index_getnext_slot - get the next tuple from a scan
  *
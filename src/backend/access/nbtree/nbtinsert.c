@@ -315,6 +315,14 @@ search:
  * rightmost page (we give up if we'd have to wait for the lock).  We assume
  * that it isn't useful to apply the optimization when there is contention,
  * since each per-backend cache won't stay valid for long.
+ *
+ * Concurrent inserters of monotonically increasing keys still serialize on
+ * the rightmost leaf page's exclusive lock, fastpath or not; that's inherent
+ * in all of them needing to place their tuple at the same point in the key
+ * space.  Deferring inserts in backend-local memory to apply them in bulk
+ * would conflict with unique checking, which must see every committed or
+ * in-progress duplicate, and with the rule that an index tuple exists
+ * before the heap tuple it points to can become visible to anyone else.
  */
 static BTStack
 _bt_search_insert(Relation rel, Relation heaprel, BTInsertState insertstate)
@@ -21,8 +21,10 @@
 #include "access/nbtree.h"
 #include "access/relscan.h"
 #include "access/stratnum.h"
+#include "catalog/catalog.h"
 #include "commands/progress.h"
 #include "commands/vacuum.h"
+#include "miscadmin.h"
 #include "nodes/execnodes.h"
 #include "pgstat.h"
 #include "storage/bulk_write.h"
@@ -36,6 +38,7 @@
 #include "utils/fmgrprotos.h"
 #include "utils/index_selfuncs.h"
 #include "utils/memutils.h"
+#include "utils/spccache.h"
 #include "utils/wait_event.h"
 
 
@@ -147,6 +150,7 @@ bthandler(PG_FUNCTION_ARGS)
 
 		.ambuild = btbuild,
 		.ambuildempty = btbuildempty,
+		.ambuildparallelok = NULL,
 		.aminsert = btinsert,
 		.aminsertcleanup = NULL,
 		.ambulkdelete = btbulkdelete,
@@ -163,6 +167,7 @@ bthandler(PG_FUNCTION_ARGS)
 		.amrescan = btrescan,
 		.amgettuple = btgettuple,
 		.amgetbitmap = btgetbitmap,
+		.amgetbatch = btgetbatch,
 		.amendscan = btendscan,
 		.ammarkpos = btmarkpos,
 		.amrestrpos = btrestrpos,
@@ -284,6 +289,46 @@ btgettuple(IndexScanDesc scan, ScanDirection dir)
 	return res;
 }
 
+/*
+ * btgetbatch() -- report upcoming btgettuple results on a heap block
+ *
+ * We only report TIDs from the items already saved in so->currPos, starting
+ * with the item btgettuple returned last.  The scan position isn't changed.
+ */
+int
+btgetbatch(IndexScanDesc scan, BlockNumber heapblk, ItemPointer tids,
+		   int maxtids)
+{
+	BTScanOpaque so = (BTScanOpaque) scan->opaque;
+	BTScanPos	pos = &so->currPos;
+	int			ntids = 0;
+	int			i;
+
+	if (!BTScanPosIsValid(*pos))
+		return 0;
+
+	if (ScanDirectionIsForward(pos->dir))
+	{
+		for (i = pos->itemIndex; i <= pos->lastItem && ntids < maxtids; i++)
+		{
+			if (ItemPointerGetBlockNumber(&pos->items[i].heapTid) != heapblk)
+				break;
+			tids[ntids++] = pos->items[i].heapTid;
+		}
+	}
+	else
+	{
+		for (i = pos->itemIndex; i >= pos->firstItem && ntids < maxtids; i--)
+		{
+			if (ItemPointerGetBlockNumber(&pos->items[i].heapTid) != heapblk)
+				break;
+			tids[ntids++] = pos->items[i].heapTid;
+		}
+	}
+
+	return ntids;
+}
+
 /*
  * btgetbitmap() -- gets all matching tuples, and adds them to a bitmap
  */
@@ -366,6 +411,7 @@ btbeginscan(Relation rel, int nkeys, int norderbys)
 
 	so->killedItems = NULL;		/* until needed */
 	so->numKilled = 0;
+	so->prefetchMaximum = -1; /* until btrescan */
 
 	/*
 	 * We don't know yet whether the scan will be index-only, so we do not
@@ -420,6 +466,30 @@ btrescan(IndexScanDesc scan, ScanKey scankey, int nscankeys,
 				   IsMVCCLikeSnapshot(scan->xs_snapshot) &&
 				   scan->heapRelation != NULL);
 
+	/*
+	 * Plain index scans prefetch the heap blocks referenced by upcoming
+	 * currPos items, so that the table AM's heap fetches of those TIDs are
+	 * less likely to stall on synchronous reads.  Index-only scans mostly
+	 * avoid heap accesses, and bitmap scans don't fetch heap tuples here at
+	 * all, so neither of them prefetches.  Like so->dropPin, this is only
+	 * determined once per scan.
+	 *
+	 * Catalog scans must not consult the tablespace cache: looking up the
+	 * tablespace's settings scans a catalog index itself, which would recurse
+	 * back here.  Use the plain GUC for those, as read_stream.c does.
+	 */
+	if (so->prefetchMaximum < 0)
+	{
+		if (scan->xs_want_itup || scan->heapRelation == NULL)
+			so->prefetchMaximum = 0;
+		else if (!OidIsValid(MyDatabaseId) ||
+				 IsCatalogRelation(scan->heapRelation))
+			so->prefetchMaximum = effective_io_concurrency;
+		else
+			so->prefetchMaximum =
+				get_tablespace_io_concurrency(scan->heapRelation->rd_rel->reltablespace);
+	}
+
 	so->markItemIndex = -1;
 	so->needPrimScan = false;
 	so->scanBehind = false;
@@ -18,10 +18,12 @@
 #include "access/nbtree.h"
 #include "access/relscan.h"
 #include "access/xact.h"
+#include "common/int.h"
 #include "executor/instrument_node.h"
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "storage/predicate.h"
+#include "utils/fmgroids.h"
 #include "utils/lsyscache.h"
 #include "utils/rel.h"
 
@@ -34,6 +36,7 @@ static OffsetNumber _bt_binsrch(Relation rel, BTScanInsert key, Buffer buf);
 static int	_bt_binsrch_posting(BTScanInsert key, Page page,
 								OffsetNumber offnum);
 static inline void _bt_returnitem(IndexScanDesc scan, BTScanOpaque so);
+static void _bt_prefetch_heap(IndexScanDesc scan, BTScanOpaque so);
 static bool _bt_steppage(IndexScanDesc scan, ScanDirection dir);
 static bool _bt_readfirstpage(IndexScanDesc scan, OffsetNumber offnum,
 							  ScanDirection dir);
@@ -762,11 +765,22 @@ _bt_compare(Relation rel,
 			 * _bt_compare as comparing the scankey to the index item, we have
 			 * to flip the sign of the comparison result.  (Unless it's a DESC
 			 * column, in which case we *don't* flip the sign.)
+			 *
+			 * Point lookups on integer keys are common enough that it's worth
+			 * avoiding the function call overhead for the default int4 and
+			 * int8 comparators, whose results we can compute inline.
 			 */
-			result = DatumGetInt32(FunctionCall2Coll(&scankey->sk_func,
-													 scankey->sk_collation,
-													 datum,
-													 scankey->sk_argument));
+			if (scankey->sk_func.fn_oid == F_BTINT4CMP)
+				result = pg_cmp_s32(DatumGetInt32(datum),
+									DatumGetInt32(scankey->sk_argument));
+			else if (scankey->sk_func.fn_oid == F_BTINT8CMP)
+				result = pg_cmp_s64(DatumGetInt64(datum),
+									DatumGetInt64(scankey->sk_argument));
+			else
+				result = DatumGetInt32(FunctionCall2Coll(&scankey->sk_func,
+														 scankey->sk_collation,
+														 datum,
+														 scankey->sk_argument));
 
 			if (!(scankey->sk_flags & SK_BT_DESC))
 				INVERT_COMPARE_RESULT(result);
@@ -1632,6 +1646,63 @@ _bt_returnitem(IndexScanDesc scan, BTScanOpaque so)
 	scan->xs_heaptid = currItem->heapTid;
 	if (so->currTuples)
 		scan->xs_itup = (IndexTuple) (so->currTuples + currItem->tupleOffset);
+
+	/* Keep the heap block prefetch window ahead of the item just returned */
+	if (so->prefetchMaximum > 0)
+		_bt_prefetch_heap(scan, so);
+}
+
+/*
+ * Issue prefetch requests for heap blocks referenced by the items that follow
+ * so->currPos.itemIndex (in the saved position's scan direction).
+ *
+ * The items array of a leaf page tells us which heap TIDs the scan will
+ * return next, well before the table AM gets asked to fetch them.  We use
+ * that to keep up to so->prefetchMaximum items' heap blocks prefetched ahead
+ * of the scan, which lets the storage work on several reads concurrently
+ * instead of the table AM waiting for each block in turn.  Items whose heap
+ * block matches that of the item before them are skipped, since the heap
+ * fetch for the earlier item will already have brought the block in.
+ *
+ * so->currPos.nextPrefetch remembers how far ahead we got, so each item is
+ * considered only once per _bt_readpage call.  Prefetching never crosses a
+ * leaf page boundary: we only know the TIDs on the page we've already read.
+ */
+static void
+_bt_prefetch_heap(IndexScanDesc scan, BTScanOpaque so)
+{
+	BTScanPos	pos = &so->currPos;
+	Relation	heapRel = scan->heapRelation;
+	int			i;
+
+	if (ScanDirectionIsForward(pos->dir))
+	{
+		int			limit = Min(pos->itemIndex + so->prefetchMaximum,
+								pos->lastItem);
+
+		for (i = Max(pos->nextPrefetch, pos->itemIndex + 1); i <= limit; i++)
+		{
+			BlockNumber blkno = ItemPointerGetBlockNumber(&pos->items[i].heapTid);
+
+			if (blkno != ItemPointerGetBlockNumber(&pos->items[i - 1].heapTid))
+				PrefetchBuffer(heapRel, MAIN_FORKNUM, blkno);
+		}
+		pos->nextPrefetch = Max(pos->nextPrefetch, i);
+	}
+	else
+	{
+		int			limit = Max(pos->itemIndex - so->prefetchMaximum,
+								pos->firstItem);
+
+		for (i = Min(pos->nextPrefetch, pos->itemIndex - 1); i >= limit; i--)
+		{
+			BlockNumber blkno = ItemPointerGetBlockNumber(&pos->items[i].heapTid);
+
+			if (blkno != ItemPointerGetBlockNumber(&pos->items[i + 1].heapTid))
+				PrefetchBuffer(heapRel, MAIN_FORKNUM, blkno);
+		}
+		pos->nextPrefetch = Min(pos->nextPrefetch, i);
+	}
 }
 
 /*
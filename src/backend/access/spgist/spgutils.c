@@ -73,6 +73,7 @@ spghandler(PG_FUNCTION_ARGS)
 
 		.ambuild = spgbuild,
 		.ambuildempty = spgbuildempty,
+		.ambuildparallelok = NULL,
 		.aminsert = spginsert,
 		.aminsertcleanup = NULL,
 		.ambulkdelete = spgbulkdelete,
@@ -29,11 +29,13 @@
 #include "access/xlogutils.h"
 #include "funcapi.h"
 #include "miscadmin.h"
+#include "storage/proc.h"
 #include "storage/shmem.h"
 #include "storage/subsystems.h"
 #include "utils/fmgrprotos.h"
 #include "utils/guc_hooks.h"
 #include "utils/timestamp.h"
+#include "utils/wait_event.h"
 
 /*
  * Defines for CommitTs page sizes.  A page is the same BLCKSZ as is used
@@ -123,6 +125,13 @@ bool		track_commit_timestamp;
 static void SetXidCommitTsInPage(TransactionId xid, int nsubxids,
 								 TransactionId *subxids, TimestampTz ts,
 								 ReplOriginId nodeid, int64 pageno);
+static void SetXidCommitTsInPageInternal(TransactionId xid, int nsubxids,
+										 TransactionId *subxids, TimestampTz ts,
+										 ReplOriginId nodeid, int64 pageno);
+static bool TransactionGroupSetCommitTs(TransactionId xid, TimestampTz ts,
+										ReplOriginId nodeid, int64 pageno);
+static void SetLastCommitTs(TransactionId xid, TimestampTz ts,
+							ReplOriginId nodeid, TransactionId newestXact);
 static void TransactionIdSetCommitTs(TransactionId xid, TimestampTz ts,
 									 ReplOriginId nodeid, int slotno);
 static void error_commit_ts_disabled(void);
@@ -145,6 +154,11 @@ static void WriteTruncateXlogRec(int64 pageno, TransactionId oldestXid);
  * permanent) so we need to keep the information about them here. If the
  * subtrans implementation changes in the future, we might want to revisit the
  * decision of storing timestamp info for each subxid.
+ *
+ * As in clog.c, when the SLRU bank lock is contended at commit time a
+ * transaction without subtransactions joins a group, whose leader records
+ * the timestamps of all members with a single acquisition of the bank lock
+ * and of CommitTsLock.
  */
 void
 TransactionTreeSetCommitTsData(TransactionId xid, int nsubxids,
@@ -166,6 +180,31 @@ TransactionTreeSetCommitTsData(TransactionId xid, int nsubxids,
 	if (!commitTsShared->commitTsActive)
 		return;
 
+	/*
+	 * For a transaction without subtransactions, try to avoid waiting for
+	 * the SLRU bank lock: take it if it's free, otherwise let a group leader
+	 * do the work.  The group leader finds our data in MyProc, so this only
+	 * works for our own top-level XID.
+	 */
+	if (nsubxids == 0 && MyProc != NULL && xid == MyProc->xid)
+	{
+		int64		pageno = TransactionIdToCTsPage(xid);
+		LWLock	   *lock = SimpleLruGetBankLock(CommitTsCtl, pageno);
+
+		if (LWLockConditionalAcquire(lock, LW_EXCLUSIVE))
+		{
+			SetXidCommitTsInPageInternal(xid, 0, NULL, timestamp, nodeid,
+										 pageno);
+			LWLockRelease(lock);
+			SetLastCommitTs(xid, timestamp, nodeid, xid);
+			return;
+		}
+		else if (TransactionGroupSetCommitTs(xid, timestamp, nodeid, pageno))
+			return;
+
+		/* Fall through to the normal path */
+	}
+
 	/*
 	 * Figure out the latest Xid in this batch: either the last subxid if
 	 * there's any, otherwise the parent xid.
@@ -211,10 +250,20 @@ TransactionTreeSetCommitTsData(TransactionId xid, int nsubxids,
 		i = j + 1;
 	}
 
-	/* update the cached value in shared memory */
+	SetLastCommitTs(xid, timestamp, nodeid, newestXact);
+}
+
+/*
+ * Update the cached last-commit data in shared memory, and advance
+ * newestCommitTsXid to newestXact if it's behind.
+ */
+static void
+SetLastCommitTs(TransactionId xid, TimestampTz ts, ReplOriginId nodeid,
+				TransactionId newestXact)
+{
 	LWLockAcquire(CommitTsLock, LW_EXCLUSIVE);
 	commitTsShared->xidLastCommit = xid;
-	commitTsShared->dataLastCommit.time = timestamp;
+	commitTsShared->dataLastCommit.time = ts;
 	commitTsShared->dataLastCommit.nodeid = nodeid;
 
 	/* and move forwards our endpoint, if needed */
@@ -233,10 +282,27 @@ SetXidCommitTsInPage(TransactionId xid, int nsubxids,
 					 ReplOriginId nodeid, int64 pageno)
 {
 	LWLock	   *lock = SimpleLruGetBankLock(CommitTsCtl, pageno);
+
+	LWLockAcquire(lock, LW_EXCLUSIVE);
+	SetXidCommitTsInPageInternal(xid, nsubxids, subxids, ts, nodeid, pageno);
+	LWLockRelease(lock);
+}
+
+/*
+ * Workhorse for SetXidCommitTsInPage.
+ *
+ * Caller must hold the SLRU bank lock for the page.
+ */
+static void
+SetXidCommitTsInPageInternal(TransactionId xid, int nsubxids,
+							 TransactionId *subxids, TimestampTz ts,
+							 ReplOriginId nodeid, int64 pageno)
+{
 	int			slotno;
 	int			i;
 
-	LWLockAcquire(lock, LW_EXCLUSIVE);
+	Assert(LWLockHeldByMeInMode(SimpleLruGetBankLock(CommitTsCtl, pageno),
+								LW_EXCLUSIVE));
 
 	slotno = SimpleLruReadPage(CommitTsCtl, pageno, true, &xid);
 
@@ -245,8 +311,164 @@ SetXidCommitTsInPage(TransactionId xid, int nsubxids,
 		TransactionIdSetCommitTs(subxids[i], ts, nodeid, slotno);
 
 	CommitTsCtl->shared->page_dirty[slotno] = true;
+}
 
-	LWLockRelease(lock);
+/*
+ * When we cannot immediately acquire the SLRU bank lock at commit time, add
+ * ourselves to a list of processes that need their commit timestamp
+ * recorded.  The first process to add itself to the list will acquire the
+ * lock and record the timestamps of all group members, then update the
+ * shared last-commit data once for the whole group.  This follows the
+ * protocol of TransactionGroupUpdateXidStatus() in clog.c; see there for
+ * more details.
+ *
+ * Returns true when the timestamp has been recorded; returns false if we
+ * decided against applying the optimization because the page we need to
+ * update differs from those processes already waiting.
+ */
+static bool
+TransactionGroupSetCommitTs(TransactionId xid, TimestampTz ts,
+							ReplOriginId nodeid, int64 pageno)
+{
+	PGPROC	   *proc = MyProc;
+	uint32		nextidx;
+	uint32		wakeidx;
+	int64		prevpageno;
+	LWLock	   *prevlock;
+	PGPROC	   *newestproc = NULL;
+
+	Assert(TransactionIdIsValid(xid));
+
+	proc->commitTsGroupMember = true;
+	proc->commitTsGroupMemberXid = xid;
+	proc->commitTsGroupMemberTime = ts;
+	proc->commitTsGroupMemberNodeId = nodeid;
+	proc->commitTsGroupMemberPage = pageno;
+
+	nextidx = pg_atomic_read_u32(&ProcGlobal->commitTsGroupFirst);
+
+	while (true)
+	{
+		/*
+		 * Add the proc to list, if the page we need to update is the same as
+		 * the group leader's.  As in clog.c, the leader may meanwhile have
+		 * moved on to another group; that case is handled below by switching
+		 * bank locks.
+		 */
+		if (nextidx != INVALID_PROC_NUMBER &&
+			GetPGProcByNumber(nextidx)->commitTsGroupMemberPage != pageno)
+		{
+			proc->commitTsGroupMember = false;
+			pg_atomic_write_u32(&proc->commitTsGroupNext, INVALID_PROC_NUMBER);
+			return false;
+		}
+
+		pg_atomic_write_u32(&proc->commitTsGroupNext, nextidx);
+
+		if (pg_atomic_compare_exchange_u32(&ProcGlobal->commitTsGroupFirst,
+										   &nextidx,
+										   (uint32) MyProcNumber))
+			break;
+	}
+
+	/*
+	 * If the list was not empty, the leader will record our timestamp.
+	 */
+	if (nextidx != INVALID_PROC_NUMBER)
+	{
+		int			extraWaits = 0;
+
+		/* Sleep until the leader has recorded our timestamp. */
+		pgstat_report_wait_start(WAIT_EVENT_COMMIT_TS_GROUP_UPDATE);
+		for (;;)
+		{
+			/* acts as a read barrier */
+			PGSemaphoreLock(proc->sem);
+			if (!proc->commitTsGroupMember)
+				break;
+			extraWaits++;
+		}
+		pgstat_report_wait_end();
+
+		Assert(pg_atomic_read_u32(&proc->commitTsGroupNext) == INVALID_PROC_NUMBER);
+
+		/* Fix semaphore count for any absorbed wakeups */
+		while (extraWaits-- > 0)
+			PGSemaphoreUnlock(proc->sem);
+		return true;
+	}
+
+	/*
+	 * We're the leader.  Acquire the bank lock for our page, then detach the
+	 * list of waiting processes.
+	 */
+	prevpageno = pageno;
+	prevlock = SimpleLruGetBankLock(CommitTsCtl, prevpageno);
+	LWLockAcquire(prevlock, LW_EXCLUSIVE);
+
+	nextidx = pg_atomic_exchange_u32(&ProcGlobal->commitTsGroupFirst,
+									 INVALID_PROC_NUMBER);
+	wakeidx = nextidx;
+
+	/* Walk the list and record the timestamps of all members. */
+	while (nextidx != INVALID_PROC_NUMBER)
+	{
+		PGPROC	   *nextproc = GetPGProcByNumber(nextidx);
+		int64		thispageno = nextproc->commitTsGroupMemberPage;
+
+		if (thispageno != prevpageno)
+		{
+			LWLock	   *lock = SimpleLruGetBankLock(CommitTsCtl, thispageno);
+
+			if (prevlock != lock)
+			{
+				LWLockRelease(prevlock);
+				LWLockAcquire(lock, LW_EXCLUSIVE);
+			}
+			prevlock = lock;
+			prevpageno = thispageno;
+		}
+
+		SetXidCommitTsInPageInternal(nextproc->commitTsGroupMemberXid, 0, NULL,
+									 nextproc->commitTsGroupMemberTime,
+									 nextproc->commitTsGroupMemberNodeId,
+									 thispageno);
+
+		if (newestproc == NULL ||
+			TransactionIdFollows(nextproc->commitTsGroupMemberXid,
+								 newestproc->commitTsGroupMemberXid))
+			newestproc = nextproc;
+
+		nextidx = pg_atomic_read_u32(&nextproc->commitTsGroupNext);
+	}
+
+	LWLockRelease(prevlock);
+
+	/* The list always contains at least ourselves. */
+	Assert(newestproc != NULL);
+	SetLastCommitTs(newestproc->commitTsGroupMemberXid,
+					newestproc->commitTsGroupMemberTime,
+					newestproc->commitTsGroupMemberNodeId,
+					newestproc->commitTsGroupMemberXid);
+
+	/* Now wake everybody up, outside the locks. */
+	while (wakeidx != INVALID_PROC_NUMBER)
+	{
+		PGPROC	   *wakeproc = GetPGProcByNumber(wakeidx);
+
+		wakeidx = pg_atomic_read_u32(&wakeproc->commitTsGroupNext);
+		pg_atomic_write_u32(&wakeproc->commitTsGroupNext, INVALID_PROC_NUMBER);
+
+		/* ensure all previous writes are visible before follower continues. */
+		pg_write_barrier();
+
+		wakeproc->commitTsGroupMember = false;
+
+		if (wakeproc != MyProc)
+			PGSemaphoreUnlock(wakeproc->sem);
+	}
+
+	return true;
 }
 
 /*
@@ -287,6 +287,17 @@ MyOldestVisibleMXactIdSlot(void)
  *
  * We allocate the cache entries in a memory context that is deleted at
  * transaction end, so we don't need to do retail freeing of entries.
+ *
+ * Keeping the cache across transactions would help workloads with many
+ * short transactions that keep share-locking the same rows (foreign key
+ * checks on a popular parent row, for instance), but it is not just a matter
+ * of moving the memory context.  mXactCacheGetBySet() hands out an existing
+ * MultiXactId for reuse, which is only safe because any multi created in the
+ * current transaction is newer than our OldestMemberMXactId; a multi
+ * remembered from an earlier transaction could already be older than the
+ * cutoff that vacuum uses to truncate members.  Lookups by ID would also have
+ * to cope with the cached multi being truncated away and eventually its ID
+ * being reused after wraparound.
  */
 typedef struct mXactCacheEnt
 {
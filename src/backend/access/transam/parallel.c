@@ -16,6 +16,7 @@
 
 #include "access/brin.h"
 #include "access/gin.h"
+#include "access/gist_private.h"
 #include "access/nbtree.h"
 #include "access/parallel.h"
 #include "access/session.h"
@@ -154,6 +155,9 @@ static const struct
 	{
 		"_gin_parallel_build_main", _gin_parallel_build_main
 	},
+	{
+		"_gist_parallel_build_main", _gist_parallel_build_main
+	},
 	{
 		"parallel_vacuum_main", parallel_vacuum_main
 	}
@@ -578,6 +582,14 @@ ReinitializeParallelWorkers(ParallelContext *pcxt, int nworkers_to_launch)
 
 /*
  * Launch parallel workers.
+ *
+ * Each worker is a fresh dynamic background worker, forked by the postmaster
+ * for this parallel context and exiting when it is done.  Workers are not
+ * pooled between queries: ParallelWorkerMain() restores the leader's GUCs,
+ * snapshots, transaction state and authenticated identity from the DSM
+ * segment, and none of that can be cleanly unwound again, so a reusable
+ * worker would need to reset as much state as a new process starts without.
+ * The launch cost is what parallel_setup_cost is meant to account for.
  */
 void
 LaunchParallelWorkers(ParallelContext *pcxt)
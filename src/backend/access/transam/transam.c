@@ -25,14 +25,29 @@
 #include "utils/snapmgr.h"
 
 /*
- * Single-item cache for results of TransactionLogFetch.  It's worth having
- * such a cache because we frequently find ourselves repeatedly checking the
- * same XID, for example when scanning a table just after a bulk insert,
- * update, or delete.
+ * Small direct-mapped cache for results of TransactionLogFetch.  It's worth
+ * having such a cache because we frequently find ourselves repeatedly
+ * checking the same XID, for example when scanning a table just after a bulk
+ * insert, update, or delete.  Having more than one entry helps when the
+ * tuples of a page were written by a handful of interleaved transactions,
+ * which would otherwise evict each other and send every check to the clog's
+ * SLRU, with its bank locks.
+ *
+ * Only final statuses are cached, so entries never become stale.
  */
-static TransactionId cachedFetchXid = InvalidTransactionId;
-static XidStatus cachedFetchXidStatus;
-static XLogRecPtr cachedCommitLSN;
+#define XID_STATUS_CACHE_SIZE	64		/* must be a power of 2 */
+
+typedef struct XidStatusCacheEntry
+{
+	TransactionId xid;
+	XidStatus	status;
+	XLogRecPtr	lsn;
+} XidStatusCacheEntry;
+
+static XidStatusCacheEntry xidStatusCache[XID_STATUS_CACHE_SIZE];
+
+#define XidStatusCacheSlot(xid) \
+	(&xidStatusCache[(xid) & (XID_STATUS_CACHE_SIZE - 1)])
 
 /* Local functions */
 static XidStatus TransactionLogFetch(TransactionId transactionId);
@@ -51,15 +66,19 @@ static XidStatus TransactionLogFetch(TransactionId transactionId);
 static XidStatus
 TransactionLogFetch(TransactionId transactionId)
 {
+	XidStatusCacheEntry *entry = XidStatusCacheSlot(transactionId);
 	XidStatus	xidstatus;
 	XLogRecPtr	xidlsn;
 
 	/*
-	 * Before going to the commit log manager, check our single item cache to
-	 * see if we didn't just check the transaction status a moment ago.
+	 * Before going to the commit log manager, check our cache to see if we
+	 * didn't just check the transaction status a moment ago.  Since the
+	 * cache is zero-initialized, an unused entry can only match
+	 * InvalidTransactionId, which isn't normal and is never cached.
 	 */
-	if (TransactionIdEquals(transactionId, cachedFetchXid))
-		return cachedFetchXidStatus;
+	if (TransactionIdEquals(transactionId, entry->xid) &&
+		TransactionIdIsNormal(transactionId))
+		return entry->status;
 
 	/*
 	 * Also, check to see if the transaction ID is a permanent one.
@@ -85,9 +104,9 @@ TransactionLogFetch(TransactionId transactionId)
 	if (xidstatus != TRANSACTION_STATUS_IN_PROGRESS &&
 		xidstatus != TRANSACTION_STATUS_SUB_COMMITTED)
 	{
-		cachedFetchXid = transactionId;
-		cachedFetchXidStatus = xidstatus;
-		cachedCommitLSN = xidlsn;
+		entry->xid = transactionId;
+		entry->status = xidstatus;
+		entry->lsn = xidlsn;
 	}
 
 	return xidstatus;
@@ -317,20 +336,22 @@ TransactionIdLatest(TransactionId mainxid,
 XLogRecPtr
 TransactionIdGetCommitLSN(TransactionId xid)
 {
+	XidStatusCacheEntry *entry;
 	XLogRecPtr	result;
 
+	/* Special XIDs are always known committed */
+	if (!TransactionIdIsNormal(xid))
+		return InvalidXLogRecPtr;
+
 	/*
 	 * Currently, all uses of this function are for xids that were just
 	 * reported to be committed by TransactionLogFetch, so we expect that
 	 * checking TransactionLogFetch's cache will usually succeed and avoid an
 	 * extra trip to shared memory.
 	 */
-	if (TransactionIdEquals(xid, cachedFetchXid))
-		return cachedCommitLSN;
-
-	/* Special XIDs are always known committed */
-	if (!TransactionIdIsNormal(xid))
-		return InvalidXLogRecPtr;
+	entry = XidStatusCacheSlot(xid);
+	if (TransactionIdEquals(xid, entry->xid))
+		return entry->lsn;
 
 	/*
 	 * Get the transaction status.
@@ -122,6 +122,7 @@ int			max_wal_size_mb = 1024; /* 1 GB */
 int			min_wal_size_mb = 80;	/* 80 MB */
 int			wal_keep_size_mb = 0;
 int			XLOGbuffers = -1;
+int			NumXLogInsertLocks = -1;
 int			XLogArchiveTimeout = 0;
 int			XLogArchiveMode = ARCHIVE_MODE_OFF;
 char	   *XLogArchiveCommand = NULL;
@@ -150,11 +151,12 @@ bool		XLOG_DEBUG = false;
 int			wal_segment_size = DEFAULT_XLOG_SEG_SIZE;
 
 /*
- * Number of WAL insertion locks to use. A higher value allows more insertions
- * to happen concurrently, but adds some CPU overhead to flushing the WAL,
- * which needs to iterate all the locks.
+ * Number of WAL insertion locks to use (wal_insert_locks). A higher value
+ * allows more insertions to happen concurrently, but adds some CPU overhead
+ * to flushing the WAL, which needs to iterate all the locks.  The value is
+ * fixed at server start; see XLOGChooseNumInsertLocks() for the default.
  */
-#define NUM_XLOGINSERT_LOCKS  8
+#define NUM_XLOGINSERT_LOCKS  NumXLogInsertLocks
 
 /*
  * Max distance from last checkpoint, before triggering a new xlog-based
@@ -710,6 +712,7 @@ static bool InstallXLogFileSegment(XLogSegNo *segno, char *tmppath,
 								   bool find_free, XLogSegNo max_segno,
 								   TimeLineID tli);
 static void XLogFileClose(void);
+static void XLogWriteback(XLogRecPtr startptr, XLogRecPtr endptr);
 static void PreallocXlogFiles(XLogRecPtr endptr, TimeLineID tli);
 static void RemoveTempXlogFiles(void);
 static void RemoveOldXlogFiles(XLogSegNo segno, XLogRecPtr lastredoptr,
@@ -838,8 +841,8 @@ XLogInsertRecord(XLogRecData *rdata,
 	 * To keep track of which insertions are still in-progress, each concurrent
 	 * inserter acquires an insertion lock. In addition to just indicating that
 	 * an insertion is in progress, the lock tells others how far the inserter
-	 * has progressed. There is a small fixed number of insertion locks,
-	 * determined by NUM_XLOGINSERT_LOCKS. When an inserter crosses a page
+	 * has progressed. There is a small number of insertion locks, determined
+	 * by NUM_XLOGINSERT_LOCKS at server start. When an inserter crosses a page
 	 * boundary, it updates the value stored in the lock to the how far it has
 	 * inserted, to allow the previous buffer to be flushed.
 	 *
@@ -2975,6 +2978,32 @@ XLogFlush(XLogRecPtr record)
 	Assert(!XLogNeedsFlush(record));
 }
 
+/*
+ * Start kernel writeback of the WAL between startptr and endptr that lies in
+ * the segment we have open, for XLogBackgroundFlush().
+ *
+ * This is only a hint, so it's skipped where it's pointless: when the WAL is
+ * written synchronously or with direct I/O anyway.
+ */
+static void
+XLogWriteback(XLogRecPtr startptr, XLogRecPtr endptr)
+{
+	XLogRecPtr	segstart;
+
+	if (openLogFile < 0 ||
+		wal_sync_method == WAL_SYNC_METHOD_OPEN ||
+		wal_sync_method == WAL_SYNC_METHOD_OPEN_DSYNC ||
+		(io_direct_flags & IO_DIRECT_WAL))
+		return;
+
+	XLogSegNoOffsetToRecPtr(openLogSegNo, 0, wal_segment_size, segstart);
+	startptr = Max(startptr, segstart);
+	endptr = Min(endptr, segstart + wal_segment_size);
+
+	if (endptr > startptr)
+		pg_flush_data(openLogFile, startptr - segstart, endptr - startptr);
+}
+
 /*
  * Write & flush xlog, but without specifying exactly where to.
  *
@@ -3008,6 +3037,7 @@ XLogBackgroundFlush(void)
 	TimestampTz now;
 	int			flushblocks;
 	TimeLineID	insertTLI;
+	XLogRecPtr	prevWrite;
 
 	/* XLOG doesn't need flushing during recovery */
 	if (RecoveryInProgress())
@@ -3110,6 +3140,7 @@ XLogBackgroundFlush(void)
 	WaitXLogInsertionsToFinish(WriteRqst.Write);
 	LWLockAcquire(WALWriteLock, LW_EXCLUSIVE);
 	RefreshXLogWriteResult(LogwrtResult);
+	prevWrite = LogwrtResult.Write;
 	if (WriteRqst.Write > LogwrtResult.Write ||
 		WriteRqst.Flush > LogwrtResult.Flush)
 	{
@@ -3119,6 +3150,17 @@ XLogBackgroundFlush(void)
 
 	END_CRIT_SECTION();
 
+	/*
+	 * If we wrote WAL without flushing it, ask the kernel to start writing it
+	 * back now.  That lets the device work on it while more WAL is generated,
+	 * so that whoever issues the eventual fsync has less to wait for.  This
+	 * is done only here, after releasing WALWriteLock, so that it can't
+	 * lengthen anyone's wait for the lock if initiating writeback blocks.
+	 */
+	if (WriteRqst.Flush == InvalidXLogRecPtr &&
+		LogwrtResult.Write > prevWrite)
+		XLogWriteback(prevWrite, LogwrtResult.Write);
+
 	/* wake up walsenders now that we've released heavily contended locks */
 	WalSndWakeupProcessRequests(true, !RecoveryInProgress());
 
@@ -5032,6 +5074,57 @@ XLOGChooseNumBuffers(void)
 	return xbuffers;
 }
 
+/*
+ * Auto-tune the number of WAL insertion locks.
+ *
+ * Eight locks, which was the fixed number before wal_insert_locks existed,
+ * are enough unless a lot of backends insert WAL at the same time.  Beyond
+ * that we add a lock for every 16 allowed connections, so that the inserters
+ * can still spread out over the locks, up to a maximum of 64.  More locks make
+ * WaitXLogInsertionsToFinish() more expensive, since it has to look at all of
+ * them.
+ *
+ * This should not be called until MaxConnections has received its final
+ * value.
+ */
+static int
+XLOGChooseNumInsertLocks(void)
+{
+	int			nlocks;
+
+	nlocks = MaxConnections / 16;
+	if (nlocks < 8)
+		nlocks = 8;
+	if (nlocks > 64)
+		nlocks = 64;
+	return nlocks;
+}
+
+/*
+ * GUC check_hook for wal_insert_locks
+ */
+bool
+check_wal_insert_locks(int *newval, void **extra, GucSource source)
+{
+	/* Zero locks would make any WAL insertion impossible */
+	if (*newval == 0)
+	{
+		GUC_check_errdetail("\"%s\" must be -1 or between 1 and %d.",
+							"wal_insert_locks", MAX_WAL_INSERT_LOCKS);
+		return false;
+	}
+
+	/*
+	 * -1 indicates a request for auto-tune.  If we haven't yet changed the
+	 * boot_val default of -1, just let it be.  We'll fix it when
+	 * XLOGShmemRequest is called.
+	 */
+	if (*newval == -1 && NumXLogInsertLocks != -1)
+		*newval = XLOGChooseNumInsertLocks();
+
+	return true;
+}
+
 /*
  * GUC check_hook for wal_buffers
  */
@@ -5318,6 +5411,20 @@ XLOGShmemRequest(void *arg)
 	}
 	Assert(XLOGbuffers > 0);
 
+	/* Likewise for wal_insert_locks, which depends on MaxConnections */
+	if (NumXLogInsertLocks == -1)
+	{
+		char		buf[32];
+
+		snprintf(buf, sizeof(buf), "%d", XLOGChooseNumInsertLocks());
+		SetConfigOption("wal_insert_locks", buf, PGC_POSTMASTER,
+						PGC_S_DYNAMIC_DEFAULT);
+		if (NumXLogInsertLocks == -1)	/* failed to apply it? */
+			SetConfigOption("wal_insert_locks", buf, PGC_POSTMASTER,
+							PGC_S_OVERRIDE);
+	}
+	Assert(NumXLogInsertLocks > 0);
+
 	/* XLogCtl */
 	size = sizeof(XLogCtlData);
 
@@ -18,8 +18,23 @@
  * recorded in the decoded record so that XLogReadBufferForRedo() can try to
  * avoid a second buffer mapping table lookup.
  *
+ * Reads are started with StartReadBuffer(), so with an asynchronous
+ * io_method the pages are read into shared buffers in the background and are
+ * normally resident by the time redo asks for them.  The prefetcher holds a
+ * pin on each such buffer until the record that needs it is about to be
+ * replayed, at which point the read is waited for and the pin dropped, since
+ * redo routines may need a cleanup lock.  With io_method=sync this degrades
+ * to issuing read-ahead advice, as before.
+ *
+ * Because a read may now complete into the buffer pool well before the
+ * record that wanted it is replayed, we must not read a block from disk while
+ * an earlier record that is yet to be replayed will restore a full page image
+ * of it or initialize it: the on-disk copy may be torn, and would fail
+ * verification.  Such blocks are remembered until those records have been
+ * replayed.
+ *
  * Currently, only the main fork is considered for prefetching.  Currently,
- * prefetching is only effective on systems where PrefetchBuffer() does
+ * prefetching is only enabled on systems where PrefetchBuffer() does
  * something useful (mainly Linux).
  *
  *-------------------------------------------------------------------------
@@ -29,6 +44,7 @@
 
 #include "access/xlogprefetcher.h"
 #include "access/xlogreader.h"
+#include "catalog/pg_class.h"
 #include "catalog/pg_control.h"
 #include "catalog/storage_xlog.h"
 #include "commands/dbcommands_xlog.h"
@@ -146,6 +162,10 @@ struct XLogPrefetcher
 	/* Book-keeping to disable prefetching temporarily. */
 	XLogRecPtr	no_readahead_until;
 
+	/* Blocks being read, or not to be read until an earlier record is replayed. */
+	HTAB	   *block_table;
+	dlist_head	block_queue;
+
 	/* IO depth manager. */
 	LsnReadQueue *streaming_read;
 
@@ -168,6 +188,27 @@ typedef struct XLogPrefetcherFilter
 	dlist_node	link;
 } XLogPrefetcherFilter;
 
+/*
+ * A main fork block that the prefetcher is tracking.  If buffer is valid, we
+ * hold a pin on it and a read described by op may be in progress.  Otherwise
+ * the record at lsn will restore or initialize the block, and we must not
+ * read it from disk before then.
+ */
+typedef struct XLogPrefetcherBlockKey
+{
+	RelFileLocator rlocator;
+	BlockNumber blkno;
+} XLogPrefetcherBlockKey;
+
+typedef struct XLogPrefetcherBlock
+{
+	XLogPrefetcherBlockKey key;
+	XLogRecPtr	lsn;
+	Buffer		buffer;
+	ReadBuffersOperation op;
+	dlist_node	link;
+} XLogPrefetcherBlock;
+
 /*
  * Counters exposed in shared memory for pg_stat_recovery_prefetch.
  */
@@ -196,6 +237,17 @@ static inline bool XLogPrefetcherIsFiltered(XLogPrefetcher *prefetcher,
 											BlockNumber blockno);
 static inline void XLogPrefetcherCompleteFilters(XLogPrefetcher *prefetcher,
 												 XLogRecPtr replaying_lsn);
+static XLogPrefetcherBlock *XLogPrefetcherTrackBlock(XLogPrefetcher *prefetcher,
+													 RelFileLocator rlocator,
+													 BlockNumber blkno,
+													 XLogRecPtr lsn,
+													 bool *found);
+static void XLogPrefetcherForgetBlock(XLogPrefetcher *prefetcher,
+									  XLogPrefetcherBlock *entry);
+static void XLogPrefetcherCompleteBlocks(XLogPrefetcher *prefetcher,
+										 XLogRecPtr lsn);
+static void XLogPrefetcherUnpinRecordBlocks(XLogPrefetcher *prefetcher,
+											DecodedXLogRecord *record);
 static LsnReadQueueNextStatus XLogPrefetcherNextBlock(uintptr_t pgsr_private,
 													  XLogRecPtr *lsn);
 
@@ -378,6 +430,12 @@ XLogPrefetcherAllocate(XLogReaderState *reader)
 										   &ctl, HASH_ELEM | HASH_BLOBS);
 	dlist_init(&prefetcher->filter_queue);
 
+	ctl.keysize = sizeof(XLogPrefetcherBlockKey);
+	ctl.entrysize = sizeof(XLogPrefetcherBlock);
+	prefetcher->block_table = hash_create("XLogPrefetcherBlockTable", 1024,
+										  &ctl, HASH_ELEM | HASH_BLOBS);
+	dlist_init(&prefetcher->block_queue);
+
 	SharedStats->wal_distance = 0;
 	SharedStats->block_distance = 0;
 	SharedStats->io_depth = 0;
@@ -394,7 +452,9 @@ XLogPrefetcherAllocate(XLogReaderState *reader)
 void
 XLogPrefetcherFree(XLogPrefetcher *prefetcher)
 {
+	XLogPrefetcherCompleteBlocks(prefetcher, PG_UINT64_MAX);
 	lrq_free(prefetcher->streaming_read);
+	hash_destroy(prefetcher->block_table);
 	hash_destroy(prefetcher->filter_table);
 	pfree(prefetcher);
 }
@@ -451,10 +511,10 @@ XLogPrefetcherComputeStats(XLogPrefetcher *prefetcher)
  * Returns LRQ_NEXT_AGAIN if no more WAL data is available yet.
  *
  * Returns LRQ_NEXT_IO if the next block reference is for a main fork block
- * that isn't in the buffer pool, and the kernel has been asked to start
- * reading it to make a future read system call faster. An LSN is written to
- * *lsn, and the I/O will be considered to have completed once that LSN is
- * replayed.
+ * that isn't in the buffer pool, and a read of it into the buffer pool has
+ * been started (or, with io_method=sync, the kernel has been advised to read
+ * it ahead).  An LSN is written to *lsn, and the I/O will be considered to
+ * have completed once that LSN is replayed.
  *
  * Returns LRQ_NEXT_NO_IO if we examined the next block reference and found
  * that it was already in the buffer pool, or we decided for various reasons
@@ -587,6 +647,29 @@ XLogPrefetcherNextBlock(uintptr_t pgsr_private, XLogRecPtr *lsn)
 						 "suppressing prefetch in database %u until %X/%08X is replayed due to raw file copy",
 						 rlocator.dbOid,
 						 LSN_FORMAT_ARGS(record->lsn));
+#endif
+				}
+				else if (record_type == XLOG_DBASE_DROP)
+				{
+					xl_dbase_drop_rec *xlrec =
+						(xl_dbase_drop_rec *) record->main_data;
+					RelFileLocator rlocator =
+					{InvalidOid, xlrec->db_id, InvalidRelFileNumber};
+
+					/*
+					 * Replaying the drop invalidates every buffer of the
+					 * database, in all tablespaces, and fails if we hold a
+					 * pin on one of them on behalf of a later record.  That
+					 * happens when a database is moved to another tablespace,
+					 * as the copy in the old one is dropped afterwards.
+					 */
+					XLogPrefetcherAddFilter(prefetcher, rlocator, 0, record->lsn);
+
+#ifdef XLOGPREFETCHER_DEBUG_LEVEL
+					elog(XLOGPREFETCHER_DEBUG_LEVEL,
+						 "suppressing prefetch in database %u until %X/%08X is replayed, which drops the database",
+						 rlocator.dbOid,
+						 LSN_FORMAT_ARGS(record->lsn));
 #endif
 				}
 			}
@@ -652,7 +735,8 @@ XLogPrefetcherNextBlock(uintptr_t pgsr_private, XLogRecPtr *lsn)
 			int			block_id = prefetcher->next_block_id++;
 			DecodedBkpBlock *block = &record->blocks[block_id];
 			SMgrRelation reln;
-			PrefetchBufferResult result;
+			XLogPrefetcherBlock *entry;
+			bool		found;
 
 			if (!block->in_use)
 				continue;
@@ -678,6 +762,11 @@ XLogPrefetcherNextBlock(uintptr_t pgsr_private, XLogRecPtr *lsn)
 			 */
 			if (block->has_image)
 			{
+				/* Nor must we read it until the image has been restored. */
+				if (block->apply_image)
+					(void) XLogPrefetcherTrackBlock(prefetcher, block->rlocator,
+													block->blkno, record->lsn,
+													&found);
 				XLogPrefetchIncrement(&SharedStats->skip_fpw);
 				return LRQ_NEXT_NO_IO;
 			}
@@ -685,6 +774,9 @@ XLogPrefetcherNextBlock(uintptr_t pgsr_private, XLogRecPtr *lsn)
 			/* There is no point in reading a page that will be zeroed. */
 			if (block->flags & BKPBLOCK_WILL_INIT)
 			{
+				(void) XLogPrefetcherTrackBlock(prefetcher, block->rlocator,
+												block->blkno, record->lsn,
+												&found);
 				XLogPrefetchIncrement(&SharedStats->skip_init);
 				return LRQ_NEXT_NO_IO;
 			}
@@ -768,38 +860,47 @@ XLogPrefetcherNextBlock(uintptr_t pgsr_private, XLogRecPtr *lsn)
 				return LRQ_NEXT_NO_IO;
 			}
 
-			/* Try to initiate prefetching. */
-			result = PrefetchSharedBuffer(reln, block->forknum, block->blkno);
-			if (BufferIsValid(result.recent_buffer))
+			/*
+			 * Skip the block if a read of it is already in progress, or an
+			 * earlier record will restore or initialize it.
+			 */
+			entry = XLogPrefetcherTrackBlock(prefetcher, block->rlocator,
+											 block->blkno, record->lsn,
+											 &found);
+			if (found)
 			{
-				/* Cache hit, nothing to do. */
-				XLogPrefetchIncrement(&SharedStats->hit);
-				block->prefetch_buffer = result.recent_buffer;
+				if (BufferIsValid(entry->buffer))
+					block->prefetch_buffer = entry->buffer;
+				XLogPrefetchIncrement(&SharedStats->skip_rep);
 				return LRQ_NEXT_NO_IO;
 			}
-			else if (result.initiated_io)
-			{
-				/* Cache miss, I/O (presumably) started. */
-				XLogPrefetchIncrement(&SharedStats->prefetch);
-				block->prefetch_buffer = InvalidBuffer;
-				return LRQ_NEXT_IO;
-			}
-			else if ((io_direct_flags & IO_DIRECT_DATA) == 0)
+
+			/* Try to initiate prefetching. */
+			entry->op.rel = NULL;
+			entry->op.smgr = reln;
+			entry->op.persistence = RELPERSISTENCE_PERMANENT;
+			entry->op.forknum = block->forknum;
+			entry->op.strategy = NULL;
+			if (StartReadBuffer(&entry->op, &entry->buffer, block->blkno,
+								READ_BUFFERS_ISSUE_ADVICE))
 			{
 				/*
-				 * This shouldn't be possible, because we already determined
-				 * that the relation exists on disk and is big enough.
-				 * Something is wrong with the cache invalidation for
-				 * smgrexists(), smgrnblocks(), or the file was unlinked or
-				 * truncated beneath our feet?
+				 * Cache miss, I/O started.  We keep the pin until the record
+				 * is about to be replayed, and recovery can then find the
+				 * buffer without another buffer mapping table lookup.
 				 */
-				elog(ERROR,
-					 "could not prefetch relation %u/%u/%u block %u",
-					 reln->smgr_rlocator.locator.spcOid,
-					 reln->smgr_rlocator.locator.dbOid,
-					 reln->smgr_rlocator.locator.relNumber,
-					 block->blkno);
+				XLogPrefetchIncrement(&SharedStats->prefetch);
+				block->prefetch_buffer = entry->buffer;
+				return LRQ_NEXT_IO;
 			}
+
+			/* Cache hit, nothing to do. */
+			XLogPrefetchIncrement(&SharedStats->hit);
+			block->prefetch_buffer = entry->buffer;
+			ReleaseBuffer(entry->buffer);
+			entry->buffer = InvalidBuffer;
+			XLogPrefetcherForgetBlock(prefetcher, entry);
+			return LRQ_NEXT_NO_IO;
 		}
 
 		/*
@@ -961,12 +1062,116 @@ XLogPrefetcherIsFiltered(XLogPrefetcher *prefetcher, RelFileLocator rlocator,
 	return false;
 }
 
+/*
+ * Start tracking a main fork block referenced by the record at 'lsn'.  If it
+ * was already being tracked, *found is set and the entry's lifetime is
+ * extended to cover this record.
+ */
+static XLogPrefetcherBlock *
+XLogPrefetcherTrackBlock(XLogPrefetcher *prefetcher, RelFileLocator rlocator,
+						 BlockNumber blkno, XLogRecPtr lsn, bool *found)
+{
+	XLogPrefetcherBlockKey key;
+	XLogPrefetcherBlock *entry;
+
+	key.rlocator = rlocator;
+	key.blkno = blkno;
+	entry = hash_search(prefetcher->block_table, &key, HASH_ENTER, found);
+	if (!*found)
+	{
+		entry->lsn = lsn;
+		entry->buffer = InvalidBuffer;
+		dlist_push_head(&prefetcher->block_queue, &entry->link);
+	}
+	else
+	{
+		entry->lsn = lsn;
+		dlist_delete(&entry->link);
+		dlist_push_head(&prefetcher->block_queue, &entry->link);
+	}
+
+	return entry;
+}
+
+/*
+ * Wait for any read of a tracked block to finish, release our pin, and stop
+ * tracking it.
+ */
+static void
+XLogPrefetcherForgetBlock(XLogPrefetcher *prefetcher, XLogPrefetcherBlock *entry)
+{
+	if (BufferIsValid(entry->buffer))
+	{
+		WaitReadBuffers(&entry->op);
+		ReleaseBuffer(entry->buffer);
+	}
+	dlist_delete(&entry->link);
+	hash_search(prefetcher->block_table, &entry->key, HASH_REMOVE, NULL);
+}
+
+/*
+ * Stop tracking blocks that were referenced by records up to and including
+ * the one at 'lsn'.
+ */
+static void
+XLogPrefetcherCompleteBlocks(XLogPrefetcher *prefetcher, XLogRecPtr lsn)
+{
+	while (!dlist_is_empty(&prefetcher->block_queue))
+	{
+		XLogPrefetcherBlock *entry = dlist_tail_element(XLogPrefetcherBlock,
+														link,
+														&prefetcher->block_queue);
+
+		if (entry->lsn > lsn)
+			break;
+
+		XLogPrefetcherForgetBlock(prefetcher, entry);
+	}
+}
+
+/*
+ * Before a record is replayed, drop any pins we hold on the blocks it
+ * references on behalf of later records.  The redo routine might need a
+ * cleanup lock, which our own extra pin would make impossible.  The entries
+ * are kept, so that the blocks are not read again.
+ */
+static void
+XLogPrefetcherUnpinRecordBlocks(XLogPrefetcher *prefetcher,
+								DecodedXLogRecord *record)
+{
+	if (dlist_is_empty(&prefetcher->block_queue))
+		return;
+
+	for (int block_id = 0; block_id <= record->max_block_id; ++block_id)
+	{
+		DecodedBkpBlock *block = &record->blocks[block_id];
+		XLogPrefetcherBlockKey key;
+		XLogPrefetcherBlock *entry;
+
+		if (!block->in_use || block->forknum != MAIN_FORKNUM)
+			continue;
+
+		key.rlocator = block->rlocator;
+		key.blkno = block->blkno;
+		entry = hash_search(prefetcher->block_table, &key, HASH_FIND, NULL);
+		if (entry && BufferIsValid(entry->buffer))
+		{
+			WaitReadBuffers(&entry->op);
+			ReleaseBuffer(entry->buffer);
+			entry->buffer = InvalidBuffer;
+		}
+	}
+}
+
 /*
  * A wrapper for XLogBeginRead() that also resets the prefetcher.
  */
 void
 XLogPrefetcherBeginRead(XLogPrefetcher *prefetcher, XLogRecPtr recPtr)
 {
+	/* Wait for reads we started, and release their pins. */
+	XLogPrefetcherCompleteBlocks(prefetcher, PG_UINT64_MAX);
+
 	/* This will forget about any in-flight IO. */
 	prefetcher->reconfigure_count--;
 
@@ -998,13 +1203,20 @@ XLogPrefetcherReadRecord(XLogPrefetcher *prefetcher, char **errmsg)
 		uint32		max_distance;
 		uint32		max_inflight;
 
+		XLogPrefetcherCompleteBlocks(prefetcher, PG_UINT64_MAX);
 		if (prefetcher->streaming_read)
 			lrq_free(prefetcher->streaming_read);
 
 		if (RecoveryPrefetchEnabled())
 		{
 			Assert(maintenance_io_concurrency > 0);
-			max_inflight = maintenance_io_concurrency;
+
+			/*
+			 * Each I/O in flight holds a buffer pin, so leave room for the
+			 * pins that redo itself needs.
+			 */
+			max_inflight = Min(maintenance_io_concurrency,
+							   Max(GetPinLimit() / 2, 1));
 			max_distance = max_inflight * XLOGPREFETCHER_DISTANCE_MULTIPLIER;
 		}
 		else
@@ -1071,6 +1283,13 @@ XLogPrefetcherReadRecord(XLogPrefetcher *prefetcher, char **errmsg)
 	if (record == prefetcher->record)
 		prefetcher->record = NULL;
 
+	/*
+	 * Finish the reads for this record's blocks, and make sure we don't hold
+	 * pins that could get in the way of its redo routine.
+	 */
+	XLogPrefetcherCompleteBlocks(prefetcher, record->lsn);
+	XLogPrefetcherUnpinRecordBlocks(prefetcher, record);
+
 	/*
 	 * See if it's time to compute some statistics, because enough WAL has
 	 * been processed.
@@ -1883,6 +1883,28 @@ PerformWalRecovery(void)
 
 /*
  * Subroutine of PerformWalRecovery, to apply one WAL record.
+ *
+ * Records are applied strictly one at a time, in LSN order, by the startup
+ * process.  XLogPrefetcher hides most of the read I/O, but the redo routines
+ * themselves still run serially.  Handing block-level records to a pool of
+ * redo workers partitioned by buffer tag has been suggested, and the ordering
+ * rules would be roughly: records touching a single block may run on the
+ * worker that owns that block; records touching several blocks, or none
+ * (transaction commit/abort, checkpoint, relation and database create/drop,
+ * standby lock and snapshot records), act as barriers that wait for every
+ * worker to drain before running here.  The hard parts are elsewhere,
+ * though.  Many redo routines are not pure functions of the page: they update
+ * shared state (TransamVariables, CLOG, the KnownAssignedXids machinery,
+ * invalidation queues, the FSM) that assumes a single writer, and hot standby
+ * visibility requires that a commit not become visible before every earlier
+ * change of that transaction has been applied, so replayEndRecPtr and
+ * lastReplayedEndRecPtr would have to track the minimum LSN completed by all
+ * workers rather than the last record read.  Recovery conflict handling,
+ * minRecoveryPoint updates and the full-page-write consistency checks would
+ * all need the same treatment.  Until that groundwork exists, the cheapest
+ * ways to reduce replay lag remain prefetching (recovery_prefetch) and
+ * keeping full_page_writes and wal_compression on so that fewer records
+ * need CPU-heavy redo.
  */
 static void
 ApplyWalRecord(XLogReaderState *xlogreader, XLogRecord *record, TimeLineID *replayTLI)
@@ -298,6 +298,19 @@ XLogCheckInvalidPages(void)
  * be.  This will force us to replay all subsequent modifications of the page
  * that appear in XLOG, rather than possibly ignoring them as already
  * applied, but that's not a huge drawback.
+ *
+ * The page LSN is the only thing that tells us a change has already reached
+ * disk; there is no ARIES-style dirty page table saved with checkpoints that
+ * would let us skip records without reading the page.  Such a table would buy
+ * less here than it does in ARIES.  A checkpoint writes out every buffer that
+ * was dirty when it started, so the pages it could list are those dirtied
+ * after the redo pointer, which are exactly what replay has to visit anyway.
+ * What it could not know about are pages flushed after the checkpoint by the
+ * background writer or by backends, because buffer writes are not
+ * WAL-logged.  Also, with full_page_writes the first change to each page
+ * after the redo pointer carries an image that is restored without reading
+ * the page at all.  The remaining reads are the ones recovery_prefetch tries
+ * to get ahead of.
  */
 XLogRedoAction
 XLogReadBufferForRedo(XLogReaderState *record, uint8 block_id,
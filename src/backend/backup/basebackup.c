@@ -3,6 +3,14 @@
  * basebackup.c
  *	  code for taking a base backup and streaming it to a standby
  *
+ * The whole backup is produced by a single process, reading one file at a
+ * time and pushing it through the bbsink chain.  Server-side compression
+ * can use extra threads, but reading, checksum verification and archive
+ * construction cannot.  Spreading a backup over several replication
+ * connections would need a way to divide the file list among them under
+ * the same backup start point, and for the client to merge the per-
+ * connection manifests; that is not supported today.
+ *
  * Portions Copyright (c) 2010-2026, PostgreSQL Global Development Group
  *
  * IDENTIFICATION
@@ -3052,12 +3052,16 @@ index_build(Relation heapRelation,
 
 	/*
 	 * Determine worker process details for parallel CREATE INDEX.  Currently,
-	 * only btree, GIN, and BRIN have support for parallel builds.
+	 * only btree, GIN, BRIN, and GiST (sorted build method only) have
+	 * support for parallel builds.  An AM that can build only some of its
+	 * indexes in parallel says which through ambuildparallelok.
 	 *
 	 * Note that planner considers parallel safety for us.
 	 */
 	if (parallel && IsNormalProcessingMode() &&
-		indexRelation->rd_indam->amcanbuildparallel)
+		indexRelation->rd_indam->amcanbuildparallel &&
+		(indexRelation->rd_indam->ambuildparallelok == NULL ||
+		 indexRelation->rd_indam->ambuildparallelok(indexRelation)))
 		indexInfo->ii_ParallelWorkers =
 			plan_create_index_workers(RelationGetRelid(heapRelation),
 									  RelationGetRelid(indexRelation));
@@ -1257,6 +1257,15 @@ block_sampling_read_stream_next(ReadStream *stream,
  * unbiased estimates of the average numbers of live and dead rows per
  * block.  The previous sampling method put too much credence in the row
  * density near the start of the table.
+ *
+ * Note that the amount of I/O done here depends on targrows, not on the size
+ * of the table, so ANALYZE of a very large table reads no more blocks than
+ * ANALYZE of a table just big enough to fill the sample.  One might hope to
+ * do better for append-mostly tables by sampling only the block ranges that
+ * changed since the last ANALYZE and merging the result with what we had
+ * before, but the statistics we store (MCV lists, histograms, correlation)
+ * are not mergeable, so that would require keeping per-range reservoirs or
+ * sketches somewhere, and the n_distinct estimate would need replacing too.
  */
 static int
 acquire_sample_rows(Relation onerel, int elevel,
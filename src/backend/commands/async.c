@@ -142,6 +142,12 @@
  *	  if they are far behind the current queue head; that is to ensure that
  *	  we can advance the queue tail without undue delay.
  *
+ *	  There is deliberately only one queue.  NOTIFY guarantees that
+ *	  notifications are delivered in commit order across all channels, which
+ *	  a queue sharded by channel could only provide by merging the shards
+ *	  on the reader side; and a backend that does wake up still reads, and
+ *	  skips, entries for channels it isn't listening on.
+ *
  * An application that listens on the same channel it notifies will get
  * NOTIFY messages for its own NOTIFYs.  These can be ignored, if not useful,
  * by comparing be_pid in the NOTIFY message to the application's own backend's
@@ -73,6 +73,13 @@
 /*
  * Trim the list of buffers back down to this number after flushing.  This
  * must be >= 2.
+ *
+ * Since each partition gets its own buffer and all buffers are flushed
+ * together, rows need not arrive grouped by partition to be multi-inserted;
+ * rows for up to this many partitions are collected between flushes.  When
+ * more partitions than this are active (e.g., many hash partitions), the
+ * surplus buffers are torn down and rebuilt after each flush, although the
+ * batches themselves are no smaller.
  */
 #define MAX_PARTITION_BUFFERS	32
 
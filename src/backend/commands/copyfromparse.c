@@ -75,6 +75,7 @@
 #include "port/pg_bswap.h"
 #include "port/simd.h"
 #include "utils/builtins.h"
+#include "utils/fmgroids.h"
 #include "utils/rel.h"
 #include "utils/wait_event.h"
 
@@ -151,6 +152,8 @@ static int	CopyReadAttributesCSV(CopyFromState cstate);
 static Datum CopyReadBinaryAttribute(CopyFromState cstate, FmgrInfo *flinfo,
 									 Oid typioparam, int32 typmod,
 									 bool *isnull);
+static bool CopyReadBinaryFixedWidth(CopyFromState cstate, FmgrInfo *flinfo,
+									 int32 fld_size, Datum *result);
 static pg_always_inline bool CopyFromTextLikeOneRow(CopyFromState cstate,
 													ExprContext *econtext,
 													Datum *values,
@@ -1833,6 +1836,10 @@ CopyReadAttributesText(CopyFromState cstate)
 	char	   *output_ptr;
 	char	   *cur_ptr;
 	char	   *line_end_ptr;
+#ifndef USE_NO_SIMD
+	const Vector8 delim_vec = vector8_broadcast(delimc);
+	const Vector8 bs_vec = vector8_broadcast('\\');
+#endif
 
 	/*
 	 * We need a special case for zero-column tables: check that the input
@@ -1897,6 +1904,36 @@ CopyReadAttributesText(CopyFromState cstate)
 		 * not* throw any syntax errors before we've done the null-marker
 		 * check.
 		 */
+#ifndef USE_NO_SIMD
+
+		/*
+		 * Most fields contain no backslashes, so first use SIMD instructions
+		 * to copy the leading run of ordinary characters in bulk.  The scalar
+		 * loop below takes over at the first delimiter or backslash.
+		 */
+		while (line_end_ptr - cur_ptr >= sizeof(Vector8))
+		{
+			Vector8		chunk;
+			Vector8		match;
+
+			vector8_load(&chunk, (const uint8 *) cur_ptr);
+			match = vector8_or(vector8_eq(chunk, delim_vec),
+							   vector8_eq(chunk, bs_vec));
+			if (vector8_is_highbit_set(match))
+			{
+				int			runlen;
+
+				runlen = pg_rightmost_one_pos32(vector8_highbit_mask(match));
+				memcpy(output_ptr, cur_ptr, runlen);
+				output_ptr += runlen;
+				cur_ptr += runlen;
+				break;
+			}
+			memcpy(output_ptr, cur_ptr, sizeof(Vector8));
+			output_ptr += sizeof(Vector8);
+			cur_ptr += sizeof(Vector8);
+		}
+#endif
 		for (;;)
 		{
 			char		c;
@@ -2296,6 +2333,12 @@ CopyReadBinaryAttribute(CopyFromState cstate, FmgrInfo *flinfo,
 				(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
 				 errmsg("invalid field size")));
 
+	if (CopyReadBinaryFixedWidth(cstate, flinfo, fld_size, &result))
+	{
+		*isnull = false;
+		return result;
+	}
+
 	/* reset attribute_buf to empty, and load raw data in it */
 	resetStringInfo(&cstate->attribute_buf);
 
@@ -2322,3 +2365,85 @@ CopyReadBinaryAttribute(CopyFromState cstate, FmgrInfo *flinfo,
 	*isnull = false;
 	return result;
 }
+
+/*
+ * Decode a binary field of one of the common fixed-width types directly,
+ * rather than calling the type's receive function.  The results must match
+ * those of int2recv() and friends.  Returns false, without consuming any
+ * input, if the field isn't of such a type or doesn't have the expected
+ * size; the caller then falls back to the receive function, which will also
+ * take care of reporting any error.
+ */
+static bool
+CopyReadBinaryFixedWidth(CopyFromState cstate, FmgrInfo *flinfo,
+						 int32 fld_size, Datum *result)
+{
+	int32		expected;
+	union
+	{
+		uint16		u16;
+		uint32		u32;
+		uint64		u64;
+		char		bytes[8];
+	}			buf;
+
+	switch (flinfo->fn_oid)
+	{
+		case F_INT2RECV:
+			expected = sizeof(int16);
+			break;
+		case F_INT4RECV:
+		case F_FLOAT4RECV:
+			expected = sizeof(int32);
+			break;
+		case F_INT8RECV:
+		case F_FLOAT8RECV:
+			expected = sizeof(int64);
+			break;
+		default:
+			return false;
+	}
+
+	if (fld_size != expected)
+		return false;
+
+	if (CopyReadBinaryData(cstate, buf.bytes, fld_size) != fld_size)
+		ereport(ERROR,
+				(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
+				 errmsg("unexpected EOF in COPY data")));
+
+	switch (flinfo->fn_oid)
+	{
+		case F_INT2RECV:
+			*result = Int16GetDatum((int16) pg_ntoh16(buf.u16));
+			break;
+		case F_INT4RECV:
+			*result = Int32GetDatum((int32) pg_ntoh32(buf.u32));
+			break;
+		case F_FLOAT4RECV:
+			{
+				uint32		u = pg_ntoh32(buf.u32);
+				float4		f;
+
+				memcpy(&f, &u, sizeof(f));
+				*result = Float4GetDatum(f);
+			}
+			break;
+		case F_INT8RECV:
+			*result = Int64GetDatum((int64) pg_ntoh64(buf.u64));
+			break;
+		case F_FLOAT8RECV:
+			{
+				uint64		u = pg_ntoh64(buf.u64);
+				float8		f;
+
+				memcpy(&f, &u, sizeof(f));
+				*result = Float8GetDatum(f);
+			}
+			break;
+		default:
+			pg_unreachable();
+	}
+
+	return true;
+}
@@ -33,8 +33,10 @@
 #include "mb/pg_wchar.h"
 #include "miscadmin.h"
 #include "pgstat.h"
+#include "port/simd.h"
 #include "storage/fd.h"
 #include "tcop/tcopprot.h"
+#include "utils/fmgroids.h"
 #include "utils/json.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
@@ -159,6 +161,8 @@ static void CopySendEndOfRow(CopyToState cstate);
 static void CopySendTextLikeEndOfRow(CopyToState cstate);
 static void CopySendInt32(CopyToState cstate, int32 val);
 static void CopySendInt16(CopyToState cstate, int16 val);
+static bool CopySendBinaryFixedWidth(CopyToState cstate, Oid sendfn,
+									 Datum value);
 
 /*
  * COPY TO routines for built-in formats.
@@ -502,7 +506,9 @@ CopyToBinaryOneRow(CopyToState cstate, TupleTableSlot *slot)
 		{
 			CopySendInt32(cstate, -1);
 		}
-		else
+		else if (!CopySendBinaryFixedWidth(cstate,
+										   out_functions[attnum - 1].fn_oid,
+										   value))
 		{
 			bytea	   *outputbytes;
 
@@ -715,6 +721,58 @@ CopySendInt16(CopyToState cstate, int16 val)
 	CopySendData(cstate, &buf, sizeof(buf));
 }
 
+/*
+ * CopySendBinaryFixedWidth sends a binary field of one of the common
+ * fixed-width types, length word included, without calling the type's send
+ * function.  The output must match that of int2send() and friends.  Returns
+ * false if 'sendfn' isn't one of the functions handled here.
+ */
+static bool
+CopySendBinaryFixedWidth(CopyToState cstate, Oid sendfn, Datum value)
+{
+	switch (sendfn)
+	{
+		case F_INT2SEND:
+			CopySendInt32(cstate, sizeof(int16));
+			CopySendInt16(cstate, DatumGetInt16(value));
+			return true;
+		case F_INT4SEND:
+			CopySendInt32(cstate, sizeof(int32));
+			CopySendInt32(cstate, DatumGetInt32(value));
+			return true;
+		case F_FLOAT4SEND:
+			{
+				float4		f = DatumGetFloat4(value);
+				uint32		u;
+
+				memcpy(&u, &f, sizeof(u));
+				CopySendInt32(cstate, sizeof(float4));
+				CopySendInt32(cstate, (int32) u);
+			}
+			return true;
+		case F_INT8SEND:
+		case F_FLOAT8SEND:
+			{
+				uint64		u;
+
+				if (sendfn == F_INT8SEND)
+					u = (uint64) DatumGetInt64(value);
+				else
+				{
+					float8		f = DatumGetFloat8(value);
+
+					memcpy(&u, &f, sizeof(u));
+				}
+				CopySendInt32(cstate, sizeof(uint64));
+				u = pg_hton64(u);
+				CopySendData(cstate, &u, sizeof(u));
+			}
+			return true;
+		default:
+			return false;
+	}
+}
+
 /*
  * Closes the pipe to an external program, checking the pclose() return code.
  */
@@ -1528,9 +1586,38 @@ CopyAttributeOutText(CopyToState cstate, const char *string)
 	}
 	else
 	{
+#ifndef USE_NO_SIMD
+		const char *end = ptr + strlen(ptr);
+		const char *scalar_end = ptr;
+#endif
+
 		start = ptr;
 		while ((c = *ptr) != '\0')
 		{
+#ifndef USE_NO_SIMD
+
+			/*
+			 * Skip over whole vectors that need no escaping.  Once we hit one
+			 * that does, examine it byte-by-byte below before trying again.
+			 */
+			if (ptr >= scalar_end)
+			{
+				while (end - ptr >= sizeof(Vector8))
+				{
+					Vector8		chunk;
+
+					vector8_load(&chunk, (const uint8 *) ptr);
+					if (vector8_has_le(chunk, 0x1F) ||
+						vector8_has(chunk, '\\') ||
+						vector8_has(chunk, (uint8) delimc))
+						break;
+					ptr += sizeof(Vector8);
+				}
+				scalar_end = ptr + sizeof(Vector8);
+				if ((c = *ptr) == '\0')
+					break;
+			}
+#endif
 			if ((unsigned char) c < (unsigned char) 0x20)
 			{
 				/*
@@ -48,6 +48,13 @@
 #include "utils/rls.h"
 #include "utils/snapmgr.h"
 
+/*
+ * Limits on how much we buffer before flushing with table_multi_insert().
+ * These match the limits used by COPY FROM.
+ */
+#define MAX_INTOREL_BUFFERED_TUPLES		1000
+#define MAX_INTOREL_BUFFERED_BYTES		65535
+
 typedef struct
 {
 	DestReceiver pub;			/* publicly-known function pointers */
@@ -58,6 +65,9 @@ typedef struct
 	CommandId	output_cid;		/* cmin to insert in output tuples */
 	uint32		ti_options;		/* table_tuple_insert performance options */
 	BulkInsertState bistate;	/* bulk insert state */
+	TupleTableSlot **slots;		/* tuples buffered for table_multi_insert */
+	int			nbuffered;		/* number of entries in slots[] in use */
+	Size		bufferedBytes;	/* approximate size of buffered tuples */
 } DR_intorel;
 
 /* utility functions for CTAS definition creation */
@@ -68,6 +78,7 @@ static ObjectAddress create_ctas_nodata(List *tlist, IntoClause *into);
 static void intorel_startup(DestReceiver *self, int operation, TupleDesc typeinfo);
 static bool intorel_receive(TupleTableSlot *slot, DestReceiver *self);
 static void intorel_shutdown(DestReceiver *self);
+static void intorel_flush_buffer(DR_intorel *myState);
 static void intorel_destroy(DestReceiver *self);
 
 
@@ -560,14 +571,40 @@ intorel_startup(DestReceiver *self, int operation, TupleDesc typeinfo)
 	myState->output_cid = GetCurrentCommandId(true);
 	myState->ti_options = TABLE_INSERT_SKIP_FSM;
 
+	/*
+	 * Materialized views are populated with frozen tuples.  Ordinarily a new
+	 * matview is filled by REFRESH MATERIALIZED VIEW logic, which writes its
+	 * new heap with TABLE_INSERT_FROZEN (see transientrel_startup()); we get
+	 * here with a matview only for EXPLAIN ANALYZE CREATE MATERIALIZED VIEW,
+	 * and should produce the same result.  Combined with
+	 * table_multi_insert(), the new pages also get marked all-visible and
+	 * all-frozen immediately, saving a later VACUUM from having to rewrite
+	 * them.
+	 *
+	 * Plain CREATE TABLE AS doesn't get this: the result is an ordinary table,
+	 * and frozen rows would become visible to concurrent repeatable-read
+	 * snapshots after commit, as with COPY FREEZE.
+	 */
+	if (is_matview)
+		myState->ti_options |= TABLE_INSERT_FROZEN;
+
 	/*
 	 * If WITH NO DATA is specified, there is no need to set up the state for
 	 * bulk inserts as there are no tuples to insert.
 	 */
 	if (!into->skipData)
+	{
 		myState->bistate = GetBulkInsertState();
+		myState->slots = palloc0_array(TupleTableSlot *,
+									   MAX_INTOREL_BUFFERED_TUPLES);
+	}
 	else
+	{
 		myState->bistate = NULL;
+		myState->slots = NULL;
+	}
+	myState->nbuffered = 0;
+	myState->bufferedBytes = 0;
 
 	/*
 	 * Valid smgr_targblock implies something already wrote to the relation.
@@ -578,6 +615,12 @@ intorel_startup(DestReceiver *self, int operation, TupleDesc typeinfo)
 
 /*
  * intorel_receive --- receive one tuple
+ *
+ * This always runs in the leader, even if the query uses a parallel plan:
+ * workers cannot write, since they share the leader's transaction but cannot
+ * assign XIDs or command IDs of their own, and the target relation's
+ * relfilenode and TABLE_INSERT_FROZEN state live only in the leader.  The
+ * batching below keeps the leader's per-tuple cost low instead.
  */
 static bool
 intorel_receive(TupleTableSlot *slot, DestReceiver *self)
@@ -587,19 +630,33 @@ intorel_receive(TupleTableSlot *slot, DestReceiver *self)
 	/* Nothing to insert if WITH NO DATA is specified. */
 	if (!myState->into->skipData)
 	{
+		TupleTableSlot *batchslot;
+
+		/*
+		 * Copy the tuple into a slot of the target relation's type and buffer
+		 * it, so that we can insert many tuples at once with
+		 * table_multi_insert().  That produces far fewer WAL records than
+		 * inserting one tuple at a time, and allows the table AM to set the
+		 * visibility map bits for pages it fills with frozen tuples.
+		 */
+		if (myState->slots[myState->nbuffered] == NULL)
+			myState->slots[myState->nbuffered] =
+				table_slot_create(myState->rel, NULL);
+		batchslot = myState->slots[myState->nbuffered];
+		ExecCopySlot(batchslot, slot);
+		myState->nbuffered++;
+
 		/*
-		 * Note that the input slot might not be of the type of the target
-		 * relation. That's supported by table_tuple_insert(), but slightly
-		 * less efficient than inserting with the right slot - but the
-		 * alternative would be to copy into a slot of the right type, which
-		 * would not be cheap either. This also doesn't allow accessing per-AM
-		 * data (say a tuple's xmin), but since we don't do that here...
+		 * Only heap tuples have a cheaply known size; for other AMs we just
+		 * rely on the tuple count limit.
 		 */
-		table_tuple_insert(myState->rel,
-						   slot,
-						   myState->output_cid,
-						   myState->ti_options,
-						   myState->bistate);
+		if (TTS_IS_BUFFERTUPLE(batchslot) || TTS_IS_HEAPTUPLE(batchslot))
+			myState->bufferedBytes +=
+				((HeapTupleTableSlot *) batchslot)->tuple->t_len;
+
+		if (myState->nbuffered >= MAX_INTOREL_BUFFERED_TUPLES ||
+			myState->bufferedBytes >= MAX_INTOREL_BUFFERED_BYTES)
+			intorel_flush_buffer(myState);
 	}
 
 	/* We know this is a newly created relation, so there are no indexes */
@@ -618,6 +675,15 @@ intorel_shutdown(DestReceiver *self)
 
 	if (!into->skipData)
 	{
+		intorel_flush_buffer(myState);
+		for (int i = 0; i < MAX_INTOREL_BUFFERED_TUPLES; i++)
+		{
+			if (myState->slots[i] != NULL)
+				ExecDropSingleTupleTableSlot(myState->slots[i]);
+		}
+		pfree(myState->slots);
+		myState->slots = NULL;
+
 		FreeBulkInsertState(myState->bistate);
 		table_finish_bulk_insert(myState->rel, myState->ti_options);
 	}
@@ -627,6 +693,29 @@ intorel_shutdown(DestReceiver *self)
 	myState->rel = NULL;
 }
 
+/*
+ * intorel_flush_buffer --- insert all buffered tuples
+ */
+static void
+intorel_flush_buffer(DR_intorel *myState)
+{
+	if (myState->nbuffered == 0)
+		return;
+
+	table_multi_insert(myState->rel,
+					   myState->slots,
+					   myState->nbuffered,
+					   myState->output_cid,
+					   myState->ti_options,
+					   myState->bistate);
+
+	for (int i = 0; i < myState->nbuffered; i++)
+		ExecClearTuple(myState->slots[i]);
+
+	myState->nbuffered = 0;
+	myState->bufferedBytes = 0;
+}
+
 /*
  * intorel_destroy --- release DestReceiver object
  */
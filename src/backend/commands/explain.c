@@ -3433,6 +3433,9 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 											  worker_hi->nbatch_original);
 			hinstrument.space_peak = Max(hinstrument.space_peak,
 										 worker_hi->space_peak);
+			hinstrument.bloom_space = Max(hinstrument.bloom_space,
+										  worker_hi->bloom_space);
+			hinstrument.bloom_rejected += worker_hi->bloom_rejected;
 		}
 	}
 
@@ -3473,6 +3476,26 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 							 hinstrument.nbuckets, hinstrument.nbatch,
 							 spacePeakKb);
 		}
+
+		if (hinstrument.bloom_space > 0)
+		{
+			uint64		bloomSpaceKb = BYTES_TO_KILOBYTES(hinstrument.bloom_space);
+
+			if (es->format != EXPLAIN_FORMAT_TEXT)
+			{
+				ExplainPropertyUInteger("Bloom Filter Memory Usage", "kB",
+										bloomSpaceKb, es);
+				ExplainPropertyInteger("Outer Rows Removed by Bloom Filter", NULL,
+									   hinstrument.bloom_rejected, es);
+			}
+			else
+			{
+				ExplainIndentText(es);
+				appendStringInfo(es->str,
+								 "Bloom Filter Memory Usage: " UINT64_FORMAT "kB  Outer Rows Removed: " INT64_FORMAT "\n",
+								 bloomSpaceKb, hinstrument.bloom_rejected);
+			}
+		}
 	}
 }
 
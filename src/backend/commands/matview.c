@@ -42,6 +42,13 @@
 #include "utils/syscache.h"
 
 
+/*
+ * Limits on how much we buffer before flushing with table_multi_insert().
+ * These match the limits used by COPY FROM and CREATE TABLE AS.
+ */
+#define MAX_TRANSIENTREL_BUFFERED_TUPLES	1000
+#define MAX_TRANSIENTREL_BUFFERED_BYTES		65535
+
 typedef struct
 {
 	DestReceiver pub;			/* publicly-known function pointers */
@@ -51,6 +58,9 @@ typedef struct
 	CommandId	output_cid;		/* cmin to insert in output tuples */
 	uint32		ti_options;		/* table_tuple_insert performance options */
 	BulkInsertState bistate;	/* bulk insert state */
+	TupleTableSlot **slots;		/* tuples buffered for table_multi_insert */
+	int			nbuffered;		/* number of entries in slots[] in use */
+	Size		bufferedBytes;	/* approximate size of buffered tuples */
 } DR_transientrel;
 
 static int	matview_maintenance_depth = 0;
@@ -59,6 +69,7 @@ static void transientrel_startup(DestReceiver *self, int operation, TupleDesc ty
 static bool transientrel_receive(TupleTableSlot *slot, DestReceiver *self);
 static void transientrel_shutdown(DestReceiver *self);
 static void transientrel_destroy(DestReceiver *self);
+static void transientrel_flush_buffer(DR_transientrel *myState);
 static uint64 refresh_matview_datafill(DestReceiver *dest, Query *query,
 									   const char *queryString, bool is_create);
 static void refresh_by_match_merge(Oid matviewOid, Oid tempOid, Oid relowner,
@@ -493,6 +504,10 @@ transientrel_startup(DestReceiver *self, int operation, TupleDesc typeinfo)
 	myState->output_cid = GetCurrentCommandId(true);
 	myState->ti_options = TABLE_INSERT_SKIP_FSM | TABLE_INSERT_FROZEN;
 	myState->bistate = GetBulkInsertState();
+	myState->slots = palloc0_array(TupleTableSlot *,
+								   MAX_TRANSIENTREL_BUFFERED_TUPLES);
+	myState->nbuffered = 0;
+	myState->bufferedBytes = 0;
 
 	/*
 	 * Valid smgr_targblock implies something already wrote to the relation.
@@ -508,25 +523,61 @@ static bool
 transientrel_receive(TupleTableSlot *slot, DestReceiver *self)
 {
 	DR_transientrel *myState = (DR_transientrel *) self;
+	TupleTableSlot *batchslot;
+
+	/*
+	 * Copy the tuple into a slot of the target relation's type and buffer it,
+	 * so that we can insert many tuples at once with table_multi_insert().
+	 * Besides writing fewer WAL records, that lets the heap mark each page it
+	 * fills with our frozen tuples all-visible and all-frozen right away, so
+	 * that neither the first readers nor a later VACUUM have to rewrite the
+	 * new matview's pages.
+	 */
+	if (myState->slots[myState->nbuffered] == NULL)
+		myState->slots[myState->nbuffered] =
+			table_slot_create(myState->transientrel, NULL);
+	batchslot = myState->slots[myState->nbuffered];
+	ExecCopySlot(batchslot, slot);
+	myState->nbuffered++;
 
 	/*
-	 * Note that the input slot might not be of the type of the target
-	 * relation. That's supported by table_tuple_insert(), but slightly less
-	 * efficient than inserting with the right slot - but the alternative
-	 * would be to copy into a slot of the right type, which would not be
-	 * cheap either. This also doesn't allow accessing per-AM data (say a
-	 * tuple's xmin), but since we don't do that here...
+	 * Only heap tuples have a cheaply known size; for other AMs we just rely
+	 * on the tuple count limit.
 	 */
+	if (TTS_IS_BUFFERTUPLE(batchslot) || TTS_IS_HEAPTUPLE(batchslot))
+		myState->bufferedBytes +=
+			((HeapTupleTableSlot *) batchslot)->tuple->t_len;
 
-	table_tuple_insert(myState->transientrel,
-					   slot,
+	if (myState->nbuffered >= MAX_TRANSIENTREL_BUFFERED_TUPLES ||
+		myState->bufferedBytes >= MAX_TRANSIENTREL_BUFFERED_BYTES)
+		transientrel_flush_buffer(myState);
+
+	/* We know this is a newly created relation, so there are no indexes */
+
+	return true;
+}
+
+/*
+ * transientrel_flush_buffer --- insert all buffered tuples
+ */
+static void
+transientrel_flush_buffer(DR_transientrel *myState)
+{
+	if (myState->nbuffered == 0)
+		return;
+
+	table_multi_insert(myState->transientrel,
+					   myState->slots,
+					   myState->nbuffered,
 					   myState->output_cid,
 					   myState->ti_options,
 					   myState->bistate);
 
-	/* We know this is a newly created relation, so there are no indexes */
+	for (int i = 0; i < myState->nbuffered; i++)
+		ExecClearTuple(myState->slots[i]);
 
-	return true;
+	myState->nbuffered = 0;
+	myState->bufferedBytes = 0;
 }
 
 /*
@@ -537,6 +588,15 @@ transientrel_shutdown(DestReceiver *self)
 {
 	DR_transientrel *myState = (DR_transientrel *) self;
 
+	transientrel_flush_buffer(myState);
+	for (int i = 0; i < MAX_TRANSIENTREL_BUFFERED_TUPLES; i++)
+	{
+		if (myState->slots[i] != NULL)
+			ExecDropSingleTupleTableSlot(myState->slots[i]);
+	}
+	pfree(myState->slots);
+	myState->slots = NULL;
+
 	FreeBulkInsertState(myState->bistate);
 
 	table_finish_bulk_insert(myState->transientrel, myState->ti_options);
@@ -840,36 +900,43 @@ refresh_by_match_merge(Oid matviewOid, Oid tempOid, Oid relowner,
 	 * must keep it around because its type is referenced from the diff table.
 	 */
 
-	/* Analyze the diff table. */
-	resetStringInfo(&querybuf);
-	appendStringInfo(&querybuf, "ANALYZE %s", diffname);
-	if (SPI_exec(querybuf.data, 0) != SPI_OK_UTILITY)
-		elog(ERROR, "SPI_exec failed: %s", querybuf.data);
-
-	OpenMatViewIncrementalMaintenance();
-
-	/* Deletes must come before inserts; do them first. */
-	resetStringInfo(&querybuf);
-	appendStringInfo(&querybuf,
-					 "DELETE FROM %s mv WHERE ctid OPERATOR(pg_catalog.=) ANY "
-					 "(SELECT diff.tid FROM %s diff "
-					 "WHERE diff.tid IS NOT NULL "
-					 "AND diff.newdata IS NULL)",
-					 matviewname, diffname);
-	if (SPI_exec(querybuf.data, 0) != SPI_OK_DELETE)
-		elog(ERROR, "SPI_exec failed: %s", querybuf.data);
-
-	/* Inserts go last. */
-	resetStringInfo(&querybuf);
-	appendStringInfo(&querybuf,
-					 "INSERT INTO %s SELECT (diff.newdata).* "
-					 "FROM %s diff WHERE tid IS NULL",
-					 matviewname, diffname);
-	if (SPI_exec(querybuf.data, 0) != SPI_OK_INSERT)
-		elog(ERROR, "SPI_exec failed: %s", querybuf.data);
-
-	/* We're done maintaining the materialized view. */
-	CloseMatViewIncrementalMaintenance();
+	/*
+	 * If the new data matched the old exactly, there is nothing to apply, so
+	 * skip analyzing the diff table and running the DELETE and INSERT.
+	 */
+	if (SPI_processed > 0)
+	{
+		/* Analyze the diff table. */
+		resetStringInfo(&querybuf);
+		appendStringInfo(&querybuf, "ANALYZE %s", diffname);
+		if (SPI_exec(querybuf.data, 0) != SPI_OK_UTILITY)
+			elog(ERROR, "SPI_exec failed: %s", querybuf.data);
+
+		OpenMatViewIncrementalMaintenance();
+
+		/* Deletes must come before inserts; do them first. */
+		resetStringInfo(&querybuf);
+		appendStringInfo(&querybuf,
+						 "DELETE FROM %s mv WHERE ctid OPERATOR(pg_catalog.=) ANY "
+						 "(SELECT diff.tid FROM %s diff "
+						 "WHERE diff.tid IS NOT NULL "
+						 "AND diff.newdata IS NULL)",
+						 matviewname, diffname);
+		if (SPI_exec(querybuf.data, 0) != SPI_OK_DELETE)
+			elog(ERROR, "SPI_exec failed: %s", querybuf.data);
+
+		/* Inserts go last. */
+		resetStringInfo(&querybuf);
+		appendStringInfo(&querybuf,
+						 "INSERT INTO %s SELECT (diff.newdata).* "
+						 "FROM %s diff WHERE tid IS NULL",
+						 matviewname, diffname);
+		if (SPI_exec(querybuf.data, 0) != SPI_OK_INSERT)
+			elog(ERROR, "SPI_exec failed: %s", querybuf.data);
+
+		/* We're done maintaining the materialized view. */
+		CloseMatViewIncrementalMaintenance();
+	}
 	table_close(tempRel, NoLock);
 	table_close(matviewRel, NoLock);
 
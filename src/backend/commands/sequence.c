@@ -54,6 +54,15 @@
  * We don't want to log each fetching of a value from a sequence,
  * so we pre-log a few fetches in advance. In the event of
  * crash we can lose (skip over) as many values as we pre-logged.
+ *
+ * Between WAL records, each nextval() still takes the sequence's buffer lock
+ * exclusively, which is what limits throughput when many sessions draw from
+ * one sequence.  The CACHE option avoids that by reserving values per
+ * backend.  Handing out values from a shared in-memory range instead would
+ * need per-sequence shared memory that outlives backends, and would still
+ * have to interact correctly with setval(), ALTER SEQUENCE and the rule that
+ * WAL for a value must be flushed before that value is visible to anything
+ * that commits.
  */
 #define SEQ_LOG_VALS	32
 
@@ -3,6 +3,14 @@
  * execAsync.c
  *	  Support routines for asynchronous execution
  *
+ * Only ForeignScan nodes can be async-capable at present.  The protocol
+ * relies on the requestee having an external event to wait for (a socket
+ * becoming readable), which is registered in a WaitEventSet.  Local scans
+ * have no such event: their I/O completes through the buffer manager and
+ * read streams, which offer no way to wait on several relations' pending
+ * reads at once, so a local scan could only "complete" a request by doing
+ * the work synchronously.
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -176,6 +176,8 @@ static Datum ExecJustHashInnerVar(ExprState *state, ExprContext *econtext, bool
 static Datum ExecJustHashOuterVarVirt(ExprState *state, ExprContext *econtext, bool *isnull);
 static Datum ExecJustHashInnerVarVirt(ExprState *state, ExprContext *econtext, bool *isnull);
 static Datum ExecJustHashOuterVarStrict(ExprState *state, ExprContext *econtext, bool *isnull);
+static bool ExecIsScanVarFuncQual(ExprState *state);
+static Datum ExecJustScanVarFuncQual(ExprState *state, ExprContext *econtext, bool *isnull);
 
 /* execution helper functions */
 static pg_always_inline void ExecEvalArrayCompareInternal(FunctionCallInfo fcinfo,
@@ -437,6 +439,18 @@ ExecReadyInterpretedExpr(ExprState *state)
 		}
 	}
 
+	/*
+	 * Quals that are an implicit AND of strict functions, each applied to a
+	 * single scan Var and otherwise constant arguments (e.g. "a > 10 AND b =
+	 * 'x'"), are very common in scans.  Evaluate those with a loop that
+	 * doesn't need to dispatch on each step.
+	 */
+	if ((state->flags & EEO_FLAG_IS_QUAL) && ExecIsScanVarFuncQual(state))
+	{
+		state->evalfunc_private = ExecJustScanVarFuncQual;
+		return;
+	}
+
 #if defined(EEO_USE_COMPUTED_GOTO)
 
 	/*
@@ -2674,6 +2688,102 @@ ExecJustApplyFuncToCase(ExprState *state, ExprContext *econtext, bool *isnull)
 	return d;
 }
 
+/*
+ * Check whether a qual's steps are SCAN_FETCHSOME, followed by one or more
+ * (SCAN_VAR, FUNCEXPR_STRICT*, QUAL) triples, followed by DONE_RETURN, where
+ * each Var is stored straight into an argument of the function consuming it.
+ * The remaining arguments of such functions are not computed by any step, so
+ * they are constants that ExecInitFunc already stored in the fcinfo.
+ */
+static bool
+ExecIsScanVarFuncQual(ExprState *state)
+{
+	int			nsteps = state->steps_len;
+
+	if (nsteps < 5 || (nsteps - 2) % 3 != 0)
+		return false;
+	if (state->steps[0].opcode != EEOP_SCAN_FETCHSOME ||
+		state->steps[nsteps - 1].opcode != EEOP_DONE_RETURN)
+		return false;
+
+	for (int off = 1; off < nsteps - 1; off += 3)
+	{
+		ExprEvalStep *varop = &state->steps[off];
+		ExprEvalStep *funcop = &state->steps[off + 1];
+		ExprEvalStep *qualop = &state->steps[off + 2];
+		FunctionCallInfo fcinfo;
+		bool		found = false;
+
+		if (varop->opcode != EEOP_SCAN_VAR ||
+			(funcop->opcode != EEOP_FUNCEXPR_STRICT &&
+			 funcop->opcode != EEOP_FUNCEXPR_STRICT_1 &&
+			 funcop->opcode != EEOP_FUNCEXPR_STRICT_2) ||
+			qualop->opcode != EEOP_QUAL)
+			return false;
+
+		fcinfo = funcop->d.func.fcinfo_data;
+		for (int argno = 0; argno < funcop->d.func.nargs; argno++)
+		{
+			if (varop->resvalue == &fcinfo->args[argno].value &&
+				varop->resnull == &fcinfo->args[argno].isnull)
+			{
+				found = true;
+				break;
+			}
+		}
+		if (!found)
+			return false;
+	}
+
+	return true;
+}
+
+/* Evaluate a qual accepted by ExecIsScanVarFuncQual */
+static Datum
+ExecJustScanVarFuncQual(ExprState *state, ExprContext *econtext, bool *isnull)
+{
+	TupleTableSlot *scanslot = econtext->ecxt_scantuple;
+	ExprEvalStep *op = &state->steps[0];
+	ExprEvalStep *lastop = &state->steps[state->steps_len - 1];
+
+	CheckOpSlotCompatibility(op, scanslot);
+	slot_getsomeattrs(scanslot, op->d.fetch.last_var);
+
+	/* like EEOP_QUAL, a NULL or false clause yields false, never NULL */
+	*isnull = false;
+
+	for (op++; op < lastop; op += 3)
+	{
+		int			attnum = op->d.var.attnum;
+		ExprEvalStep *funcop = op + 1;
+		FunctionCallInfo fcinfo = funcop->d.func.fcinfo_data;
+		NullableDatum *args = fcinfo->args;
+		Datum		d;
+
+		Assert(attnum >= 0 && attnum < scanslot->tts_nvalid);
+
+		/* strict function, so a NULL Var makes the clause NULL */
+		if (scanslot->tts_isnull[attnum])
+			return BoolGetDatum(false);
+		*op->resvalue = scanslot->tts_values[attnum];
+		*op->resnull = false;
+
+		/* the constant arguments could be NULL too */
+		for (int argno = 0; argno < funcop->d.func.nargs; argno++)
+		{
+			if (args[argno].isnull)
+				return BoolGetDatum(false);
+		}
+
+		fcinfo->isnull = false;
+		d = funcop->d.func.fn_addr(fcinfo);
+		if (fcinfo->isnull || !DatumGetBool(d))
+			return BoolGetDatum(false);
+	}
+
+	return BoolGetDatum(true);
+}
+
 /* Simple Const expression */
 static Datum
 ExecJustConst(ExprState *state, ExprContext *econtext, bool *isnull)
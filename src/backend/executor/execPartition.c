@@ -319,6 +319,11 @@ ExecFindPartition(ModifyTableState *mtstate,
 		/*
 		 * If this partitioned table has no partitions or no partition for
 		 * these values, error out.
+		 *
+		 * Creating the missing partition on the fly is not an option here:
+		 * that would mean running DDL, with its AccessExclusiveLock-level
+		 * conflicts and relcache invalidations, in the middle of a query that
+		 * already holds a PartitionDesc for this table.
 		 */
 		if (partdesc->nparts == 0 ||
 			(partidx = get_partition_for_tuple(dispatch, values, isnull)) < 0)
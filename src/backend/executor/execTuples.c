@@ -1012,6 +1012,13 @@ tts_buffer_heap_store_tuple(TupleTableSlot *slot, HeapTuple tuple,
  * support_cstring should be passed as a const to allow the compiler only
  * emit code during inlining for cstring deforming when it's required.
  * cstrings can exist in MinimalTuples, but not in HeapTuples.
+ *
+ * Once a NULL or a variable-width column has been passed, the offset of each
+ * later column depends on the data of all earlier ones, so fetching a late
+ * column always costs a walk over the preceding ones.  Avoiding that would
+ * need per-tuple offset information in the on-disk format, which would make
+ * every tuple larger; instead, frequently accessed columns are best placed
+ * before wide or often-NULL ones.
  */
 static pg_always_inline void
 slot_deform_heap_tuple(TupleTableSlot *slot, HeapTuple tuple, uint32 *offp,
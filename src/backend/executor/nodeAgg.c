@@ -870,9 +870,10 @@ process_ordered_aggregate_single(AggState *aggstate,
 	isNull = &fcinfo->args[1].isnull;
 
 	/*
-	 * Note: if input type is pass-by-ref, the datums returned by the sort are
-	 * freshly palloc'd in the per-query context, so we must be careful to
-	 * pfree them when they are no longer needed.
+	 * Note: if input type is pass-by-ref, the datums returned by the sort
+	 * point into the sort's memory and are only valid until the next fetch,
+	 * so in DISTINCT mode we must copy the previous value to compare against
+	 * the next one, and pfree the copy when it's no longer needed.
 	 */
 
 	while (tuplesort_getdatum(pertrans->sortstates[aggstate->current_set],
@@ -906,6 +907,10 @@ process_ordered_aggregate_single(AggState *aggstate,
 
 			MemoryContextSwitchTo(oldContext);
 
+			/* Without DISTINCT, there's nothing to compare to later */
+			if (!isDistinct)
+				continue;
+
 			/*
 			 * Forget the old value, if any, and remember the new one for
 			 * subsequent equality checks.
@@ -1898,7 +1903,23 @@ hash_agg_check_limits(AggState *aggstate)
 	}
 
 	if (do_spill)
-		hash_agg_enter_spill_mode(aggstate);
+	{
+		/*
+		 * When doing the partial step of a two-step aggregation, there's no
+		 * need to spill: the groups in memory can be emitted right away, and
+		 * the finalize step will combine them with any later partial results
+		 * for the same groups.  That avoids writing and re-reading the input in
+		 * the common case that partial aggregation doesn't reduce the input
+		 * much.
+		 */
+		if (aggstate->hash_early_emit)
+		{
+			aggstate->hash_emit_pending = true;
+			aggstate->hash_ever_emitted = true;
+		}
+		else
+			hash_agg_enter_spill_mode(aggstate);
+	}
 }
 
 /*
@@ -2655,6 +2676,10 @@ agg_fill_hash_table(AggState *aggstate)
 		 * hash lookups do this too
 		 */
 		ResetExprContext(aggstate->tmpcontext);
+
+		/* If the table is full, emit its groups before reading on */
+		if (aggstate->hash_emit_pending)
+			break;
 	}
 
 	/* finalize spills, if any */
@@ -2843,7 +2868,22 @@ agg_retrieve_hash_table(AggState *aggstate)
 		result = agg_retrieve_hash_table_in_memory(aggstate);
 		if (result == NULL)
 		{
-			if (!agg_refill_hash_table(aggstate))
+			if (aggstate->hash_emit_pending)
+			{
+				/*
+				 * All groups of a table that filled up during partial
+				 * aggregation have been emitted; start over with empty
+				 * tables and the rest of the input.
+				 */
+				aggstate->hash_emit_pending = false;
+				ReScanExprContext(aggstate->hashcontext);
+				for (int setno = 0; setno < aggstate->num_hashes; setno++)
+					ResetTupleHashTable(aggstate->perhash[setno].hashtable);
+				aggstate->hash_ngroups_current = 0;
+
+				agg_fill_hash_table(aggstate);
+			}
+			else if (!agg_refill_hash_table(aggstate))
 			{
 				aggstate->agg_done = true;
 				break;
@@ -3320,6 +3360,15 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	aggstate->numtrans = 0;
 	aggstate->aggstrategy = node->aggstrategy;
 	aggstate->aggsplit = node->aggsplit;
+
+	/*
+	 * A hashed partial aggregate, whose output is combined by a finalize step
+	 * above, can emit groups early instead of spilling; see
+	 * hash_agg_check_limits().
+	 */
+	aggstate->hash_early_emit = node->aggstrategy == AGG_HASHED &&
+		DO_AGGSPLIT_SKIPFINAL(node->aggsplit) &&
+		node->plan.qual == NIL;
 	aggstate->maxsets = 0;
 	aggstate->projected_set = -1;
 	aggstate->current_set = 0;
@@ -4489,6 +4538,7 @@ ExecReScanAgg(AggState *node)
 		 * again.
 		 */
 		if (outerPlan->chgParam == NULL && !node->hash_ever_spilled &&
+			!node->hash_ever_emitted &&
 			!bms_overlap(node->ss.ps.chgParam, aggnode->aggParams))
 		{
 			ResetTupleHashIterator(node->perhash[0].hashtable,
@@ -4549,6 +4599,8 @@ ExecReScanAgg(AggState *node)
 
 		node->hash_ever_spilled = false;
 		node->hash_spill_mode = false;
+		node->hash_emit_pending = false;
+		node->hash_ever_emitted = false;
 		node->hash_ngroups_current = 0;
 
 		ReScanExprContext(node->hashcontext);
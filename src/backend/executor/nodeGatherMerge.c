@@ -9,6 +9,18 @@
  * IDENTIFICATION
  *	  src/backend/executor/nodeGatherMerge.c
  *
+ * NOTES
+ *	  The leader does an N-way merge of the workers' sorted streams, so its
+ *	  per-tuple cost grows with log(N) and, for very large sorts, the leader
+ *	  rather than the workers tends to become the bottleneck.  An alternative
+ *	  would be to have the workers agree on splitter values from a sample of
+ *	  the input and redistribute their tuples by range, so that each worker
+ *	  sorts a disjoint key range and the leader need only concatenate the
+ *	  workers' output in splitter order.  That requires a tuple exchange
+ *	  between workers, which the executor does not currently have; the
+ *	  shared tuplesort infrastructure used by parallel CREATE INDEX merges
+ *	  worker runs in the leader too, so it does not avoid the problem.
+ *
  *-------------------------------------------------------------------------
  */
 
@@ -182,9 +182,15 @@ MultiExecPrivateHash(HashState *node)
 		{
 			/* normal case with a non-null join key */
 			uint32		hashvalue = DatumGetUInt32(hashdatum);
-			int			bucketNumber;
+			int			bucketNumber = INVALID_SKEW_BUCKET_NO;
 
-			bucketNumber = ExecHashGetSkewBucket(hashtable, hashvalue);
+			/*
+			 * Test skewEnabled here rather than leaving it to
+			 * ExecHashGetSkewBucket; skew tables are rare and this loop is
+			 * run once per inner tuple.
+			 */
+			if (hashtable->skewEnabled)
+				bucketNumber = ExecHashGetSkewBucket(hashtable, hashvalue);
 			if (bucketNumber != INVALID_SKEW_BUCKET_NO)
 			{
 				/* It's a skew tuple, so put it into that hash table */
@@ -196,6 +202,10 @@ MultiExecPrivateHash(HashState *node)
 				/* Not subject to skew optimization, so insert normally */
 				ExecHashTableInsert(hashtable, slot, hashvalue);
 			}
+			if (hashtable->bloomFilter)
+				bloom_add_element(hashtable->bloomFilter,
+								  (unsigned char *) &hashvalue,
+								  sizeof(hashvalue));
 			hashtable->totalTuples += 1;
 		}
 		else if (node->keep_null_tuples)
@@ -532,6 +542,9 @@ ExecHashTableCreate(HashState *state)
 	hashtable->nbatch_original = nbatch;
 	hashtable->nbatch_outstart = nbatch;
 	hashtable->growEnabled = true;
+	hashtable->bloomFilter = NULL;
+	hashtable->bloomSpace = 0;
+	hashtable->bloomRejected = 0;
 	hashtable->totalTuples = 0;
 	hashtable->reportTuples = 0;
 	hashtable->skewTuples = 0;
@@ -2163,6 +2176,14 @@ ExecParallelPrepHashTableForUnmatched(HashJoinState *hjstate)
 	 * only one process can continue to the next phase, and all others detach
 	 * from this batch.  They can still go any work on other batches, if there
 	 * are any.
+	 *
+	 * This is also why the unmatched scan isn't divided among participants.
+	 * Match flags are only final once every process has finished probing, so
+	 * a process that stayed to help would have to wait for the others first,
+	 * which is exactly the wait we can't do here.  Processes that detach can
+	 * instead probe or scan other batches, so with several batches the
+	 * unmatched scans are still spread out; only the last batch, for each
+	 * process, has no other work to fall back on.
 	 */
 	if (!BarrierArriveAndDetachExceptLast(&batch->batch_barrier))
 	{
@@ -2929,7 +2950,8 @@ ExecHashRetrieveInstrumentation(HashState *node)
  * the largest spacePeak regardless of whether it happened in the same
  * instance as the largest nbuckets or nbatch.  All the instances should have
  * the same nbuckets_original and nbatch_original; but there's little value
- * in depending on that here, so handle them the same way.
+ * in depending on that here, so handle them the same way.  The count of
+ * outer tuples removed by the Bloom filter is summed instead.
  */
 void
 ExecHashAccumInstrumentation(HashInstrumentation *instrument,
@@ -2945,6 +2967,9 @@ ExecHashAccumInstrumentation(HashInstrumentation *instrument,
 									  hashtable->nbatch_original);
 	instrument->space_peak = Max(instrument->space_peak,
 								 hashtable->spacePeak);
+	instrument->bloom_space = Max(instrument->bloom_space,
+								  hashtable->bloomSpace);
+	instrument->bloom_rejected += hashtable->bloomRejected;
 }
 
 /*
@@ -339,6 +339,40 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 				hashtable = ExecHashTableCreate(hashNode);
 				node->hj_HashTable = hashtable;
 
+				/*
+				 * If the join is expected to need several batches, and outer
+				 * tuples without a match can simply be dropped, summarize the
+				 * inner hash values in a Bloom filter.  Outer tuples that
+				 * fail it need not be written to a batch file only to be
+				 * discarded later.  The filter must see every inner tuple, so
+				 * it can't be added once nbatch grows during the build.
+				 *
+				 * The filter is charged against the hash table's memory
+				 * budget, of which it may take up to a quarter.  bloom_create
+				 * never makes a filter smaller than 1MB, so don't bother if
+				 * the budget is smaller than that.
+				 */
+				if (!parallel && hashtable->nbatch > 1 && !HJ_FILL_OUTER(node) &&
+					hashtable->spaceAllowed / 4 >= 1024 * 1024)
+				{
+					MemoryContext oldcxt;
+					int			bloom_work_mem;
+
+					bloom_work_mem = (int) Min(hashtable->spaceAllowed / 4 / 1024,
+											   INT_MAX);
+					oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+					hashtable->bloomFilter =
+						bloom_create(Max((int64) outerPlanState(hashNode)->plan->plan_rows, 1),
+									 bloom_work_mem, 0);
+					MemoryContextSwitchTo(oldcxt);
+
+					hashtable->bloomSpace =
+						GetMemoryChunkSpace(hashtable->bloomFilter);
+					hashtable->spaceUsed += hashtable->bloomSpace;
+					if (hashtable->spaceUsed > hashtable->spacePeak)
+						hashtable->spacePeak = hashtable->spaceUsed;
+				}
+
 				/*
 				 * Execute the Hash node, to build the hash table.  If using
 				 * Parallel Hash, then we'll try to help hashing unless we
@@ -486,6 +520,20 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 					continue;
 				}
 
+				/*
+				 * While reading the outer plan, skip tuples whose hash value
+				 * cannot occur in the inner relation.
+				 */
+				if (hashtable->bloomFilter != NULL &&
+					hashtable->curbatch == 0 &&
+					bloom_lacks_element(hashtable->bloomFilter,
+										(unsigned char *) &hashvalue,
+										sizeof(hashvalue)))
+				{
+					hashtable->bloomRejected++;
+					continue;
+				}
+
 				econtext->ecxt_outertuple = outerTupleSlot;
 				node->hj_MatchedOuter = false;
 
@@ -496,8 +544,11 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 				node->hj_CurHashValue = hashvalue;
 				ExecHashGetBucketAndBatch(hashtable, hashvalue,
 										  &node->hj_CurBucketNo, &batchno);
-				node->hj_CurSkewBucketNo = ExecHashGetSkewBucket(hashtable,
-																 hashvalue);
+				if (hashtable->skewEnabled)
+					node->hj_CurSkewBucketNo = ExecHashGetSkewBucket(hashtable,
+																	 hashvalue);
+				else
+					node->hj_CurSkewBucketNo = INVALID_SKEW_BUCKET_NO;
 				node->hj_CurTuple = NULL;
 
 				/*
@@ -1311,6 +1362,18 @@ ExecHashJoinNewBatch(HashJoinState *hjstate)
 		hashtable->skewBucketNums = NULL;
 		hashtable->nSkewBuckets = 0;
 		hashtable->spaceUsedSkew = 0;
+
+		/*
+		 * Likewise, the Bloom filter is only consulted while reading the
+		 * outer plan, so release it now rather than carry it through the
+		 * remaining batches.  ExecHashTableReset will stop counting it in
+		 * spaceUsed.
+		 */
+		if (hashtable->bloomFilter)
+		{
+			bloom_free(hashtable->bloomFilter);
+			hashtable->bloomFilter = NULL;
+		}
 	}
 
 	/*
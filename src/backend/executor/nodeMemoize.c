@@ -50,6 +50,15 @@
  * demanding, then that may allow us to start putting useful entries back into
  * the cache again.
  *
+ * In a parallel plan each process has its own private cache, so workers
+ * that see the same parameter values each populate their own entries.
+ * Sharing one cache among the participants would mean keeping the entries
+ * in the query's DSA area (a dshash table in place of simplehash), copying
+ * cached tuples into shared memory, and coordinating LRU eviction and entry
+ * completion between processes; in particular a process could no longer
+ * free an entry that another participant is still reading from, or reuse
+ * another participant's incomplete entry.
+ *
  *
  * INTERFACE ROUTINES
  *		ExecMemoize			- lookup cache, exec subplan when not found
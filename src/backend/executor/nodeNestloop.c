@@ -17,6 +17,20 @@
  *		ExecNestLoop	 - process a nestloop join of two plans
  *		ExecInitNestLoop - initialize the join
  *		ExecEndNestLoop  - shut down the join
+ *
+ * NOTES
+ *		A nestloop never revisits the planner's choice, however wrong the
+ *		outer row estimate turns out to be.  An adaptive join that buffers
+ *		the first N outer rows and then decides whether to continue as a
+ *		nestloop or to build a hash table over the inner side has been
+ *		suggested.  That cannot be grafted onto this node.  The plan would
+ *		need both inner subplans (a parameterized scan for the nestloop, an
+ *		unparameterized one under a Hash node), costed and set up in
+ *		advance.  Switching would then have to replay the buffered outer
+ *		rows without emitting duplicates, and respect the different output
+ *		orderings and rescan semantics of the two strategies.  In the meantime
+ *		the main defense against runaway nestloops remains better estimates:
+ *		extended statistics, and enable_nestloop for the worst offenders.
  */
 
 #include "postgres.h"
@@ -6,6 +6,15 @@
  * To implement UNION (without ALL), we need a hashtable that stores tuples
  * already seen.  The hash key is computed from the grouping columns.
  *
+ * The working and intermediate tables are backend-local tuplestores, and
+ * the planner treats CTE scans, including the WorkTableScan that reads the
+ * working table, as parallel-restricted.  So the recursive term can be run
+ * under a Gather only for the parts that don't reference the working table,
+ * and each iteration is otherwise driven by a single process.  Running
+ * iterations in parallel would need the working table and the duplicate
+ * hashtable to live in shared memory, e.g. as a SharedTuplestore and a
+ * dshash table, with a barrier between iterations.
+ *
  *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -22,6 +22,13 @@
  * As required by the SQL spec, the output represents the value of the
  * aggregate function over all rows in the current row's window frame.
  *
+ * A WindowAgg is never itself parallel-aware: every window function needs
+ * to see its whole partition, so the node can only run above a Gather or
+ * Gather Merge (the latter lets the sort beneath it be done in parallel).
+ * Running separate partitions in separate workers would require the
+ * executor to redistribute rows among workers by a hash of the PARTITION BY
+ * columns, which we don't currently have any infrastructure for.
+ *
  *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -8,6 +8,15 @@
  *
  * A TupleQueueReader reads tuples from a shm_mq and returns the tuples.
  *
+ * Each tuple is sent as one shm_mq message.  The per-message overhead is
+ * already modest: shm_mq batches both the publication of written bytes and
+ * the acknowledgement of consumed bytes until about a quarter of the ring has
+ * accumulated, so the sender and receiver do not set each other's latches
+ * for every tuple; and a message that is contiguous in the ring is returned
+ * to the reader in place, without copying.  Packing several tuples into one
+ * message would only save the message length word and a few branches per
+ * tuple, while making the reader hand out tuples that share storage.
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
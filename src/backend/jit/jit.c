@@ -40,6 +40,7 @@ bool		jit_tuple_deforming = true;
 double		jit_above_cost = 100000;
 double		jit_inline_above_cost = 500000;
 double		jit_optimize_above_cost = 500000;
+int			jit_warmup_calls = 0;
 
 static JitProviderCallbacks provider;
 static bool provider_successfully_loaded = false;
@@ -10,6 +10,17 @@
  * IDENTIFICATION
  *	  src/backend/jit/llvm/llvmjit_expr.c
  *
+ * The emitted code is specific to one ExprState: the addresses of its steps,
+ * result slots, Const values and fmgr info are baked in as pointer constants
+ * (see the many l_ptr_const() calls below), and the generated functions are
+ * discarded with their JitContext when the query ends.  That is why compiled
+ * expressions cannot simply be cached and reused by later executions, let
+ * alone by other backends.  Doing so
+ * would first require the generated code to reach all per-execution state
+ * through its ExprState argument, so that a module depends only on the shape
+ * of the step list and tuple descriptors, which could then serve as a cache
+ * key.
+ *
  *-------------------------------------------------------------------------
  */
 
@@ -49,6 +60,10 @@ typedef struct CompiledExprState
 {
 	LLVMJitContext *context;
 	const char *funcname;
+
+	/* interpreter to use until the code is emitted, if jit_warmup_calls > 0 */
+	ExprStateEvalFunc interp_func;
+	int			ncalls;
 } CompiledExprState;
 
 
@@ -2955,6 +2970,10 @@ llvm_compile_expr(ExprState *state)
 	 * expression is actually evaluated. That allows to emit a lot of
 	 * functions together, avoiding a lot of repeated llvm and memory
 	 * remapping overhead.
+	 *
+	 * With jit_warmup_calls, evaluate the expression with the interpreter
+	 * until it has been called that many times, so that short-running
+	 * queries don't pay for optimization and emission at all.
 	 */
 	{
 
@@ -2963,6 +2982,12 @@ llvm_compile_expr(ExprState *state)
 		cstate->context = context;
 		cstate->funcname = funcname;
 
+		if (jit_warmup_calls > 0)
+		{
+			ExecReadyInterpretedExpr(state);
+			cstate->interp_func = (ExprStateEvalFunc) state->evalfunc_private;
+		}
+
 		state->evalfunc = ExecRunCompiledExpr;
 		state->evalfunc_private = cstate;
 	}
@@ -2979,10 +3004,11 @@ llvm_compile_expr(ExprState *state)
 /*
  * Run compiled expression.
  *
- * This will only be called the first time a JITed expression is called. We
- * first make sure the expression is still up-to-date, and then get a pointer to
- * the emitted function. The latter can be the first thing that triggers
- * optimizing and emitting all the generated functions.
+ * This will only be called the first time a JITed expression is called, or
+ * during the first jit_warmup_calls calls if that is set. We first make sure
+ * the expression is still up-to-date, and then get a pointer to the emitted
+ * function. The latter can be the first thing that triggers optimizing and
+ * emitting all the generated functions.
  */
 static Datum
 ExecRunCompiledExpr(ExprState *state, ExprContext *econtext, bool *isNull)
@@ -2990,7 +3016,20 @@ ExecRunCompiledExpr(ExprState *state, ExprContext *econtext, bool *isNull)
 	CompiledExprState *cstate = state->evalfunc_private;
 	ExprStateEvalFunc func;
 
-	CheckExprStillValid(state, econtext);
+	if (cstate->ncalls == 0)
+		CheckExprStillValid(state, econtext);
+
+	/*
+	 * Keep interpreting while warming up, unless the code has already been
+	 * emitted because some other expression in the query got there first.
+	 */
+	if (cstate->interp_func != NULL &&
+		!cstate->context->compiled &&
+		cstate->ncalls < jit_warmup_calls)
+	{
+		cstate->ncalls++;
+		return cstate->interp_func(state, econtext, isNull);
+	}
 
 	llvm_enter_fatal_on_oom();
 	func = (ExprStateEvalFunc) llvm_get_function(cstate->context,
@@ -179,6 +179,22 @@ addHyperLogLog(hyperLogLogState *cState, uint32 hash)
 	cState->hashesArr[index] = Max(count, cState->hashesArr[index]);
 }
 
+/*
+ * Merges the elements added to another estimator into this one.
+ *
+ * Both estimators must have been initialized with the same bit width.  The
+ * result is the same as if all the hashes had been added to cState.
+ */
+void
+mergeHyperLogLog(hyperLogLogState *cState, const hyperLogLogState *other)
+{
+	if (cState->registerWidth != other->registerWidth)
+		elog(ERROR, "cannot merge HyperLogLog states of different bit widths");
+
+	for (Size i = 0; i < cState->nRegisters; i++)
+		cState->hashesArr[i] = Max(cState->hashesArr[i], other->hashesArr[i]);
+}
+
 /*
  * Estimates cardinality, based on elements added so far
  */
@@ -17,6 +17,16 @@
  * the backend's "backend/libpq" is quite separate from "interfaces/libpq".
  * All that remains is similarities of names to trap the unwary...
  *
+ * There is no transport-level compression.  Adding it here, below the
+ * message layer, would be straightforward mechanically (compress the
+ * contents of PqSendBuffer on flush, and decompress into PqRecvBuffer on
+ * read), but it would have to be negotiated through a protocol extension
+ * during startup, and compressing data that mixes attacker-controlled and
+ * secret content over an encrypted channel exposes it to CRIME-style
+ * length-oracle attacks, which is why SSL compression was disabled; any
+ * such feature would need to let the user restrict it to cases where that
+ * is not a concern.
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
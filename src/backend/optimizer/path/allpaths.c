@@ -35,6 +35,7 @@
 #include "optimizer/clauses.h"
 #include "optimizer/cost.h"
 #include "optimizer/geqo.h"
+#include "optimizer/joininfo.h"
 #include "optimizer/optimizer.h"
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
@@ -81,6 +82,7 @@ typedef enum pushdown_safe_type
 bool		enable_geqo = false;	/* just in case GUC doesn't set it */
 bool		enable_eager_aggregate = true;
 int			geqo_threshold;
+int			geqo_strategy = GEQO_STRATEGY_GENETIC;
 double		min_eager_agg_group_size;
 int			min_parallel_table_scan_size;
 int			min_parallel_index_scan_size;
@@ -150,6 +152,7 @@ static void set_result_pathlist(PlannerInfo *root, RelOptInfo *rel,
 static void set_worktable_pathlist(PlannerInfo *root, RelOptInfo *rel,
 								   RangeTblEntry *rte);
 static RelOptInfo *make_rel_from_joinlist(PlannerInfo *root, List *joinlist);
+static void discard_join_candidate(RelOptInfo *joinrel, RelOptInfo *best);
 static bool subquery_is_pushdown_safe(Query *subquery, Query *topquery,
 									  pushdown_safety_info *safetyInfo);
 static bool recurse_pushdown_safe(Node *setOp, Query *topquery,
@@ -3913,7 +3916,11 @@ make_rel_from_joinlist(PlannerInfo *root, List *joinlist)
 		if (join_search_hook)
 			return (*join_search_hook) (root, levels_needed, initial_rels);
 		else if (enable_geqo && levels_needed >= geqo_threshold)
+		{
+			if (geqo_strategy == GEQO_STRATEGY_GREEDY)
+				return greedy_join_search(root, levels_needed, initial_rels);
 			return geqo(root, levels_needed, initial_rels);
+		}
 		else
 			return standard_join_search(root, levels_needed, initial_rels);
 	}
@@ -4059,6 +4066,178 @@ standard_join_search(PlannerInfo *root, int levels_needed, List *initial_rels)
 	return rel;
 }
 
+/*
+ * discard_join_candidate
+ *	  Finish off a candidate joinrel of greedy_join_search() that was not
+ *	  chosen.
+ */
+static void
+discard_join_candidate(RelOptInfo *joinrel, RelOptInfo *best)
+{
+	if (joinrel == NULL || joinrel == best || joinrel->pathlist == NIL)
+		return;
+
+	set_cheapest(joinrel);
+}
+
+/*
+ * greedy_join_search
+ *	  Find a join order for a large join problem by repeatedly joining the
+ *	  pair of component relations whose join is estimated to produce the
+ *	  fewest rows.
+ *
+ * This is the "greedy operator ordering" heuristic.  Unlike GEQO, the result
+ * is deterministic, and the number of make_join_rel() calls is bounded by
+ * roughly levels_needed^2, since a candidate join is only built once for each
+ * pair of current components.  Only the pairs involving a newly formed
+ * component have to be tried afresh after each step.
+ *
+ * As in GEQO, joins that have neither a join clause nor a join order
+ * restriction are postponed for as long as any other join is possible.
+ * Candidate joins that lose stay in root->join_rel_list, so they are
+ * finished off with set_cheapest() when they are discarded, like every other
+ * joinrel.  If a losing candidate's set of relations is formed again later,
+ * its paths are simply added to.
+ *
+ * The parameters and result are as for standard_join_search().
+ */
+RelOptInfo *
+greedy_join_search(PlannerInfo *root, int levels_needed, List *initial_rels)
+{
+	int			nrels = list_length(initial_rels);
+	RelOptInfo **rels;
+	RelOptInfo **cand;
+	bool	   *tried;
+	int			remaining = nrels;
+	int			savelength;
+	struct HTAB *savehash;
+	int			i;
+
+	/*
+	 * If we have to fall back to GEQO, it must start from the join_rel_list
+	 * and join_rel_hash we were given, so remember those.  As in geqo_eval(),
+	 * hide the hash table, so that the joinrels we add don't go into it.
+	 */
+	savelength = list_length(root->join_rel_list);
+	savehash = root->join_rel_hash;
+	root->join_rel_hash = NULL;
+
+	/* rels[] holds the current components; cand[] the joins of each pair */
+	rels = palloc_array(RelOptInfo *, nrels);
+	cand = palloc0_array(RelOptInfo *, nrels * nrels);
+	tried = palloc0_array(bool, nrels * nrels);
+
+	i = 0;
+	foreach_ptr(RelOptInfo, rel, initial_rels)
+		rels[i++] = rel;
+
+	while (remaining > 1)
+	{
+		RelOptInfo *best = NULL;
+		int			best_i = -1;
+		int			best_j = -1;
+		bool		is_top_rel;
+
+		/* First look at desirable joins only, then at any legal join. */
+		for (int pass = 0; pass < 2 && best == NULL; pass++)
+		{
+			for (i = 0; i < nrels; i++)
+			{
+				if (rels[i] == NULL)
+					continue;
+
+				for (int j = i + 1; j < nrels; j++)
+				{
+					int			idx = i * nrels + j;
+
+					if (rels[j] == NULL)
+						continue;
+
+					if (pass == 0 &&
+						!have_relevant_joinclause(root, rels[i], rels[j]) &&
+						!have_join_order_restriction(root, rels[i], rels[j]))
+						continue;
+
+					if (!tried[idx])
+					{
+						cand[idx] = make_join_rel(root, rels[i], rels[j]);
+						tried[idx] = true;
+					}
+
+					if (cand[idx] != NULL &&
+						(best == NULL || cand[idx]->rows < best->rows))
+					{
+						best = cand[idx];
+						best_i = i;
+						best_j = j;
+					}
+				}
+			}
+		}
+
+		/*
+		 * We should always be able to find some legal join; but if an earlier
+		 * choice has somehow painted us into a corner, let GEQO, which is
+		 * prepared to abandon orders that can't be completed, have a go.
+		 */
+		if (best == NULL)
+		{
+			root->join_rel_list = list_truncate(root->join_rel_list,
+												savelength);
+			root->join_rel_hash = savehash;
+			return geqo(root, levels_needed, initial_rels);
+		}
+
+		/* Finish off the chosen join, as standard_join_search() would. */
+		is_top_rel = bms_equal(best->relids, root->all_query_rels);
+
+		generate_partitionwise_join_paths(root, best);
+		if (!is_top_rel)
+			generate_useful_gather_paths(root, best, false);
+		set_cheapest(best);
+
+		if (best->grouped_rel != NULL && !is_top_rel)
+		{
+			RelOptInfo *grouped_rel = best->grouped_rel;
+
+			Assert(IS_GROUPED_REL(grouped_rel));
+
+			generate_grouped_paths(root, grouped_rel, best);
+			set_cheapest(grouped_rel);
+		}
+
+		/* Replace the two components by their join. */
+		rels[best_i] = best;
+		rels[best_j] = NULL;
+		remaining--;
+
+		/*
+		 * Pairs involving either of the merged components are now obsolete,
+		 * and those involving the new component need to be tried afresh.
+		 */
+		for (i = 0; i < nrels; i++)
+		{
+			int			idx_i = Min(i, best_i) * nrels + Max(i, best_i);
+			int			idx_j = Min(i, best_j) * nrels + Max(i, best_j);
+
+			discard_join_candidate(cand[idx_i], best);
+			discard_join_candidate(cand[idx_j], best);
+			tried[idx_i] = false;
+			cand[idx_i] = NULL;
+			tried[idx_j] = false;
+			cand[idx_j] = NULL;
+		}
+	}
+
+	for (i = 0; i < nrels; i++)
+	{
+		if (rels[i] != NULL)
+			return rels[i];
+	}
+
+	pg_unreachable();
+}
+
 /*****************************************************************************
  *			PUSHING QUALS DOWN INTO SUBQUERIES
  *****************************************************************************/
@@ -979,11 +979,13 @@ build_index_paths(PlannerInfo *root, RelOptInfo *rel,
 
 		/*
 		 * If appropriate, consider parallel index scan.  We don't allow
-		 * parallel index scan for bitmap index scans.
+		 * parallel index scan for bitmap index scans, nor for scans using
+		 * ordering operators, which must be done by a single process to
+		 * return tuples in distance order.
 		 */
 		if (index->amcanparallel &&
 			rel->consider_parallel && outer_relids == NULL &&
-			scantype != ST_BITMAPSCAN)
+			scantype != ST_BITMAPSCAN && orderbyclauses == NIL)
 		{
 			ipath = create_index_path(root, index,
 									  index_clauses,
@@ -315,6 +315,16 @@ expand_inherited_rtentry(PlannerInfo *root, RelOptInfo *rel,
 /*
  * expand_partitioned_rtentry
  *		Recursively expand an RTE for a partitioned table.
+ *
+ * Plan-time pruning happens before any child objects are made, so RTEs,
+ * AppendRelInfos, RelOptInfos and (later) child EquivalenceMembers exist only
+ * for partitions that survive it; pruned partitions cost nothing beyond a
+ * NULL slot in part_rels.  Child EquivalenceMembers are kept apart from the
+ * parent's, indexed by relid, so lookups don't become linear in the number of
+ * partitions either.  The case that still expands every partition is a
+ * generic plan whose quals compare the partition key with a Param; there
+ * pruning can only be done at executor startup, and the planner has to
+ * produce a subplan for each partition that might survive it.
  */
 static void
 expand_partitioned_rtentry(PlannerInfo *root, RelOptInfo *relinfo,
@@ -1203,6 +1203,13 @@ do_start_worker(void)
 	 * number of new and dead tuples per database in pgstats.  However it
 	 * isn't clear how to construct a metric that measures that and not cause
 	 * starvation for less busy databases.
+	 *
+	 * Within a database, do_autovacuum() already processes tables in order of
+	 * their autovacuum score, so a large bloated table is not stuck behind
+	 * small ones there.  The same scores could serve across databases if each
+	 * worker published the highest score it left unprocessed for its
+	 * database in shared memory, for the launcher to prefer here; the
+	 * starvation problem above would have to be addressed first.
 	 */
 	avdb = NULL;
 	for_xid_wrap = false;
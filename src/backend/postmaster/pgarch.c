@@ -379,6 +379,13 @@ pgarch_MainLoop(void)
  * pgarch_ArchiverCopyLoop
  *
  * Archives all outstanding xlogs then returns
+ *
+ * Files are handed to the archive module one at a time, and each must be
+ * archived before the next is attempted, so the archiving rate is bounded
+ * by the latency of a single archive_file_cb call.  Overlapping them would
+ * require a callback that can accept several files and report completions
+ * later; note that since .ready files are marked .done individually, such
+ * completions would not need to arrive in order.
  */
 static void
 pgarch_ArchiverCopyLoop(void)
@@ -109,6 +109,7 @@
 #include "replication/logicallauncher.h"
 #include "replication/slotsync.h"
 #include "replication/walsender.h"
+#include "storage/aio.h"
 #include "storage/aio_subsys.h"
 #include "storage/fd.h"
 #include "storage/io_worker.h"
@@ -862,6 +863,11 @@ PostmasterMain(int argc, char *argv[])
 	if (sync_replication_slots && wal_level == WAL_LEVEL_MINIMAL)
 		ereport(ERROR,
 				(errmsg("replication slot synchronization (\"sync_replication_slots\" = on) requires \"wal_level\" to be \"replica\" or \"logical\"")));
+	if ((io_direct_flags & IO_DIRECT_DATA) && io_method == IOMETHOD_SYNC)
+		ereport(WARNING,
+				(errmsg("\"%s\" includes \"%s\" but \"%s\" is \"%s\"",
+						"debug_io_direct", "data", "io_method", "sync"),
+				 errdetail("Reads of relation data cannot be issued ahead of time with direct I/O unless asynchronous I/O is used.")));
 
 	/*
 	 * Other one-time internal sanity checks can go here, if they are fast.
@@ -22,13 +22,19 @@
 #include <unistd.h>
 #include <sys/time.h>
 
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
+
 #include "common/connect.h"
 #include "funcapi.h"
 #include "libpq-fe.h"
 #include "libpq/libpq-be-fe-helpers.h"
+#include "libpq/protocol.h"
 #include "mb/pg_wchar.h"
 #include "miscadmin.h"
 #include "pgstat.h"
+#include "port/pg_bswap.h"
 #include "pqexpbuffer.h"
 #include "replication/walreceiver.h"
 #include "storage/latch.h"
@@ -50,6 +56,9 @@ struct WalReceiverConn
 	bool		logical;
 	/* Buffer for currently read records */
 	char	   *recvBuf;
+	/* Buffer for decompressed WAL data messages, and its size */
+	char	   *decompressBuf;
+	int			decompressBufSize;
 };
 
 /* Prototypes for interface functions */
@@ -77,6 +86,8 @@ static void libpqrcv_endstreaming(WalReceiverConn *conn,
 								  TimeLineID *next_tli);
 static int	libpqrcv_receive(WalReceiverConn *conn, char **buffer,
 							 pgsocket *wait_fd);
+static int	libpqrcv_decompress(WalReceiverConn *conn, char **buffer,
+								int rawlen);
 static void libpqrcv_send(WalReceiverConn *conn, const char *buffer,
 						  int nbytes);
 static char *libpqrcv_create_slot(WalReceiverConn *conn,
@@ -627,9 +638,19 @@ libpqrcv_startstreaming(WalReceiverConn *conn,
 		appendStringInfoChar(&cmd, ')');
 	}
 	else
+	{
 		appendStringInfo(&cmd, " TIMELINE %u",
 						 options->proto.physical.startpointTLI);
 
+		if (options->proto.physical.compression &&
+			PQserverVersion(conn->streamConn) >= 200000)
+		{
+			appendStringInfoString(&cmd, " (compression ");
+			appendQuotedLiteral(&cmd, options->proto.physical.compression);
+			appendStringInfoChar(&cmd, ')');
+		}
+	}
+
 	/* Start streaming. */
 	res = libpqsrv_exec(conn->streamConn,
 						cmd.data,
@@ -780,6 +801,8 @@ libpqrcv_disconnect(WalReceiverConn *conn)
 {
 	libpqsrv_disconnect(conn->streamConn);
 	PQfreemem(conn->recvBuf);
+	if (conn->decompressBuf)
+		pfree(conn->decompressBuf);
 	pfree(conn);
 }
 
@@ -878,11 +901,77 @@ libpqrcv_receive(WalReceiverConn *conn, char **buffer,
 				 errmsg("could not receive data from WAL stream: %s",
 						pchomp(PQerrorMessage(conn->streamConn)))));
 
+	/* Decompress compressed WAL data, so the caller sees a plain WALData */
+	if (conn->recvBuf[0] == PqReplMsg_CompressedWALData)
+		return libpqrcv_decompress(conn, buffer, rawlen);
+
 	/* Return received messages to caller */
 	*buffer = conn->recvBuf;
 	return rawlen;
 }
 
+/*
+ * Turn the CompressedWALData message in conn->recvBuf into a WALData message
+ * in conn->decompressBuf, and return that to the caller of libpqrcv_receive.
+ *
+ * Both have the same header, except that CompressedWALData has the length of
+ * the uncompressed data after it.
+ */
+static int
+libpqrcv_decompress(WalReceiverConn *conn, char **buffer, int rawlen)
+{
+	int			hdrlen = 1 + 3 * sizeof(int64);
+	uint32		datalen;
+
+	if (rawlen < hdrlen + (int) sizeof(uint32))
+		ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg_internal("invalid compressed WAL message received from primary")));
+
+	memcpy(&datalen, &conn->recvBuf[hdrlen], sizeof(uint32));
+	datalen = pg_ntoh32(datalen);
+	if (datalen == 0 || datalen > MaxAllocSize - hdrlen)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg_internal("invalid compressed WAL message received from primary")));
+
+#ifdef USE_LZ4
+	{
+		int			len;
+
+		if (conn->decompressBufSize < hdrlen + (int) datalen)
+		{
+			if (conn->decompressBuf)
+				pfree(conn->decompressBuf);
+			conn->decompressBufSize = hdrlen + datalen;
+			conn->decompressBuf = MemoryContextAlloc(TopMemoryContext,
+													 conn->decompressBufSize);
+		}
+
+		conn->decompressBuf[0] = PqReplMsg_WALData;
+		memcpy(&conn->decompressBuf[1], &conn->recvBuf[1], hdrlen - 1);
+
+		len = LZ4_decompress_safe(&conn->recvBuf[hdrlen + sizeof(uint32)],
+								  &conn->decompressBuf[hdrlen],
+								  rawlen - hdrlen - sizeof(uint32),
+								  datalen);
+		if (len < 0 || (uint32) len != datalen)
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg_internal("compressed WAL data received from primary is corrupt")));
+	}
+
+	*buffer = conn->decompressBuf;
+	return hdrlen + datalen;
+#else
+	/* we only get these if we asked for them */
+	ereport(ERROR,
+			(errcode(ERRCODE_PROTOCOL_VIOLATION),
+			 errmsg_internal("unexpected compressed WAL message received from primary")));
+	return -1;					/* keep compiler quiet */
+#endif
+}
+
 /*
  * Send a message to XLOG stream.
  *
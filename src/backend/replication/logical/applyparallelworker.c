@@ -43,6 +43,18 @@
  * XXX This worker pool threshold is arbitrary and we can provide a GUC
  * variable for this in the future if required.
  *
+ * Only streamed transactions are handed to parallel apply workers, because
+ * for those the publisher has already decided that they are large enough to
+ * be worth it, and the leader waits for each of them at commit anyway.
+ * Applying ordinary (non-streamed) transactions in parallel as well would
+ * need the leader to work out which transactions depend on each other, for
+ * example by tracking the replica identity keys and relations each one
+ * touches, so that it can hold back a transaction until the ones it depends
+ * on have committed, while still committing everything in publisher order.
+ * Nothing of that sort exists yet; without it, the commit order rule above
+ * makes parallel apply of small transactions no faster than applying them
+ * serially.
+ *
  * The leader apply worker will create a separate dynamic shared memory segment
  * when each parallel apply worker starts. The reason for this design is that
  * we cannot predict how many workers will be needed. It may be possible to
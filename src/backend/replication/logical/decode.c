@@ -16,6 +16,14 @@
  *		contents of records in here except turning them into a more usable
  *		format.
  *
+ *		Decoding of a slot happens in a single process.  Changes are
+ *		filtered here by database, by origin and, if the output plugin asks
+ *		for it, by relation (see FilterByRelation()), so that changes nobody
+ *		is interested in need not be queued in the reorderbuffer, let alone
+ *		spilled to disk.  Spreading the work over several processes would
+ *		need the reorderbuffer, the snapshot builder and the output plugin
+ *		state to be shared, and is not attempted.
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -32,6 +40,8 @@
 #include "access/xlog_internal.h"
 #include "access/xlogreader.h"
 #include "access/xlogrecord.h"
+#include "catalog/catalog.h"
+#include "catalog/pg_class.h"
 #include "catalog/pg_control.h"
 #include "commands/repack.h"
 #include "replication/decode.h"
@@ -40,6 +50,28 @@
 #include "replication/reorderbuffer.h"
 #include "replication/snapbuild.h"
 #include "storage/standbydefs.h"
+#include "utils/hsearch.h"
+#include "utils/inval.h"
+#include "utils/rel.h"
+#include "utils/relfilenumbermap.h"
+#include "utils/snapmgr.h"
+
+/*
+ * Entry of LogicalDecodingContext->relfilter_cache, remembering what
+ * filter_by_relation_cb said about the relation using a relfilelocator.
+ */
+typedef struct RelFilterCacheEntry
+{
+	RelFileLocator locator;		/* hash key, must be first */
+	bool		filtered;		/* should changes to it be skipped? */
+} RelFilterCacheEntry;
+
+/*
+ * Bumped by every relcache invalidation.  A context's relfilter_cache is only
+ * valid while its relfilter_generation matches this.
+ */
+static uint64 RelFilterGeneration = 0;
+static bool RelFilterCallbackRegistered = false;
 
 /* individual record(group)'s handlers */
 static void DecodeInsert(LogicalDecodingContext *ctx, XLogRecordBuffer *buf);
@@ -68,6 +100,11 @@ static inline bool FilterPrepare(LogicalDecodingContext *ctx,
 static bool DecodeTXNNeedSkip(LogicalDecodingContext *ctx,
 							  XLogRecordBuffer *buf, Oid txn_dbid,
 							  ReplOriginId origin_id);
+static bool FilterByRelation(LogicalDecodingContext *ctx, TransactionId xid,
+							 RelFileLocator *rlocator);
+static bool FilterByRelationLookup(LogicalDecodingContext *ctx,
+								   RelFileLocator *rlocator);
+static void RelFilterInvalidateCallback(Datum arg, Oid relid);
 
 /*
  * Take every XLogReadRecord()ed record and perform the actions required to
@@ -600,6 +637,170 @@ FilterByOrigin(LogicalDecodingContext *ctx, ReplOriginId origin_id)
 	return filter_by_origin_cb_wrapper(ctx, origin_id);
 }
 
+/*
+ * Ask the output plugin whether changes to the relation identified by
+ * rlocator can be skipped, before they are queued in the reorder buffer.
+ *
+ * Mapping the relfilelocator to a relation requires a catalog snapshot, which
+ * normally is only set up when the transaction is replayed at commit.  We use
+ * the snapshot builder's current snapshot instead, which is good enough as
+ * long as the transaction itself has not changed the catalogs: its changes
+ * would not be visible to that snapshot, and a relation it created or added
+ * to a publication could be misjudged.  In that case, or while the snapshot
+ * is not yet consistent, we don't filter anything.  The callback thus sees
+ * the catalogs as of the change, rather than as of the transaction's start.
+ *
+ * Starting a transaction for every change would be far too expensive, so
+ * the answers are cached by relfilelocator until the next relcache
+ * invalidation.
+ */
+static bool
+FilterByRelation(LogicalDecodingContext *ctx, TransactionId xid,
+				 RelFileLocator *rlocator)
+{
+	RelFilterCacheEntry *entry;
+	uint64		generation;
+	bool		filtered;
+
+	if (ctx->callbacks.filter_by_relation_cb == NULL)
+		return false;
+
+	if (SnapBuildCurrentState(ctx->snapshot_builder) != SNAPBUILD_CONSISTENT ||
+		ReorderBufferXidTopHasCatalogChanges(ctx->reorder, xid))
+		return false;
+
+	if (!RelFilterCallbackRegistered)
+	{
+		CacheRegisterRelcacheCallback(RelFilterInvalidateCallback, (Datum) 0);
+		RelFilterCallbackRegistered = true;
+	}
+
+	/* throw away cached answers if there was an invalidation since */
+	if (ctx->relfilter_cache != NULL &&
+		ctx->relfilter_generation != RelFilterGeneration)
+	{
+		hash_destroy(ctx->relfilter_cache);
+		ctx->relfilter_cache = NULL;
+	}
+
+	if (ctx->relfilter_cache != NULL)
+	{
+		entry = hash_search(ctx->relfilter_cache, rlocator, HASH_FIND, NULL);
+		if (entry != NULL)
+			return entry->filtered;
+	}
+
+	generation = RelFilterGeneration;
+	filtered = FilterByRelationLookup(ctx, rlocator);
+
+	/*
+	 * Don't remember the answer if an invalidation arrived while we were
+	 * computing it, since it might be based on outdated information.
+	 */
+	if (generation != RelFilterGeneration)
+		return filtered;
+
+	if (ctx->relfilter_cache == NULL)
+	{
+		HASHCTL		hash_ctl;
+
+		hash_ctl.keysize = sizeof(RelFileLocator);
+		hash_ctl.entrysize = sizeof(RelFilterCacheEntry);
+		hash_ctl.hcxt = ctx->context;
+		ctx->relfilter_cache = hash_create("logical decoding relation filter cache",
+										   64, &hash_ctl,
+										   HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+		ctx->relfilter_generation = generation;
+	}
+
+	entry = hash_search(ctx->relfilter_cache, rlocator, HASH_ENTER, NULL);
+	entry->filtered = filtered;
+
+	return filtered;
+}
+
+/*
+ * Look up the relation and call filter_by_relation_cb for it, for
+ * FilterByRelation().
+ *
+ * Relations that ReorderBufferProcessTXN() treats specially, such as TOAST
+ * tables, are never filtered: their changes are needed, or skipped anyway,
+ * regardless of what the output plugin thinks of them.
+ */
+static bool
+FilterByRelationLookup(LogicalDecodingContext *ctx, RelFileLocator *rlocator)
+{
+	MemoryContext ccxt = CurrentMemoryContext;
+	ResourceOwner cowner = CurrentResourceOwner;
+	Snapshot	snapshot;
+	bool		using_subtxn;
+	volatile bool filtered = false;
+
+	snapshot = SnapBuildGetOrBuildSnapshot(ctx->snapshot_builder);
+
+	/*
+	 * Catalog access requires a transaction.  When we're called via the SQL
+	 * SRF there's already one, so use a subtransaction there, like
+	 * ReorderBufferProcessTXN() does.
+	 */
+	using_subtxn = IsTransactionOrTransactionBlock();
+	if (using_subtxn)
+		BeginInternalSubTransaction("filter");
+	else
+		StartTransactionCommand();
+
+	SetupHistoricSnapshot(snapshot, NULL);
+
+	PG_TRY();
+	{
+		Oid			reloid;
+		Relation	relation;
+
+		reloid = RelidByRelfilenumber(rlocator->spcOid, rlocator->relNumber);
+		relation = OidIsValid(reloid) ? RelationIdGetRelation(reloid) : NULL;
+
+		if (RelationIsValid(relation))
+		{
+			if (RelationIsLogicallyLogged(relation) &&
+				!IsToastRelation(relation) &&
+				!relation->rd_rel->relrewrite &&
+				relation->rd_rel->relkind != RELKIND_SEQUENCE)
+				filtered = filter_by_relation_cb_wrapper(ctx, relation);
+
+			RelationClose(relation);
+		}
+
+		TeardownHistoricSnapshot(false);
+	}
+	PG_CATCH();
+	{
+		TeardownHistoricSnapshot(true);
+		PG_RE_THROW();
+	}
+	PG_END_TRY();
+
+	AbortCurrentTransaction();
+
+	if (using_subtxn)
+	{
+		RollbackAndReleaseCurrentSubTransaction();
+		MemoryContextSwitchTo(ccxt);
+		CurrentResourceOwner = cowner;
+	}
+
+	return filtered;
+}
+
+/*
+ * Relcache invalidation callback: cached filter_by_relation_cb answers may
+ * be stale now.
+ */
+static void
+RelFilterInvalidateCallback(Datum arg, Oid relid)
+{
+	RelFilterGeneration++;
+}
+
 /*
  * Handle rmgr LOGICALMSG_ID records for LogicalDecodingProcessRecord().
  */
@@ -940,6 +1141,16 @@ DecodeInsert(LogicalDecodingContext *ctx, XLogRecordBuffer *buf)
 	if (FilterByOrigin(ctx, XLogRecGetOrigin(r)))
 		return;
 
+	/*
+	 * Nor for this relation.  Speculative insertions need to be queued so
+	 * that their confirmation finds them, and TOAST chunks are needed by
+	 * whoever owns them.
+	 */
+	if (!(xlrec->flags & (XLH_INSERT_IS_SPECULATIVE |
+						  XLH_INSERT_ON_TOAST_RELATION)) &&
+		FilterByRelation(ctx, XLogRecGetXid(r), &target_locator))
+		return;
+
 	change = ReorderBufferAllocChange(ctx->reorder);
 	if (!(xlrec->flags & XLH_INSERT_IS_SPECULATIVE))
 		change->action = REORDER_BUFFER_CHANGE_INSERT;
@@ -990,6 +1201,10 @@ DecodeUpdate(LogicalDecodingContext *ctx, XLogRecordBuffer *buf)
 	if (FilterByOrigin(ctx, XLogRecGetOrigin(r)))
 		return;
 
+	/* nor for this relation */
+	if (FilterByRelation(ctx, XLogRecGetXid(r), &target_locator))
+		return;
+
 	change = ReorderBufferAllocChange(ctx->reorder);
 	change->action = REORDER_BUFFER_CHANGE_UPDATE;
 	change->origin_id = XLogRecGetOrigin(r);
@@ -1065,6 +1280,11 @@ DecodeDelete(LogicalDecodingContext *ctx, XLogRecordBuffer *buf)
 	if (FilterByOrigin(ctx, XLogRecGetOrigin(r)))
 		return;
 
+	/* nor for this relation, unless this is a speculative insertion's abort */
+	if (!(xlrec->flags & XLH_DELETE_IS_SUPER) &&
+		FilterByRelation(ctx, XLogRecGetXid(r), &target_locator))
+		return;
+
 	change = ReorderBufferAllocChange(ctx->reorder);
 
 	if (xlrec->flags & XLH_DELETE_IS_SUPER)
@@ -1167,6 +1387,10 @@ DecodeMultiInsert(LogicalDecodingContext *ctx, XLogRecordBuffer *buf)
 	if (FilterByOrigin(ctx, XLogRecGetOrigin(r)))
 		return;
 
+	/* nor for this relation */
+	if (FilterByRelation(ctx, XLogRecGetXid(r), &rlocator))
+		return;
+
 	/*
 	 * We know that this multi_insert isn't for a catalog, so the block should
 	 * always have data even if a full-page write of it is taken.
@@ -34,7 +34,9 @@
  *	  big as the available memory - this module supports spooling the contents
  *	  of large transactions to disk. When the transaction is replayed the
  *	  contents of individual (sub-)transactions will be read from disk in
- *	  chunks.
+ *	  chunks.  If the server was built with LZ4 support, the data of larger
+ *	  changes is compressed while it is written out, to reduce the I/O and
+ *	  disk space used by the spill files.
  *
  *	  This module also has to deal with reassembling toast records from the
  *	  individual chunks stored in WAL. When a new (or initial) version of a
@@ -89,6 +91,10 @@
 #include <unistd.h>
 #include <sys/stat.h>
 
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
+
 #include "access/detoast.h"
 #include "access/heapam.h"
 #include "access/rewriteheap.h"
@@ -190,11 +196,19 @@ typedef struct ReorderBufferToastEnt
 /* Disk serialization support datastructures */
 typedef struct ReorderBufferDiskChange
 {
-	Size		size;
+	Size		size;			/* on-disk size, including this header */
+	Size		rawsize;		/* size of the data before compression, or 0
+								 * if it is not compressed */
 	ReorderBufferChange change;
 	/* data follows */
 } ReorderBufferDiskChange;
 
+/*
+ * Changes whose data is smaller than this are not worth compressing when
+ * they are spilled to disk.
+ */
+#define SPILL_COMPRESSION_MIN_SIZE	256
+
 #define IsSpecInsert(action) \
 ( \
 	((action) == REORDER_BUFFER_CHANGE_INTERNAL_SPEC_INSERT) \
@@ -267,6 +281,8 @@ static void ReorderBufferCheckMemoryLimit(ReorderBuffer *rb);
 static void ReorderBufferSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn);
 static void ReorderBufferSerializeChange(ReorderBuffer *rb, ReorderBufferTXN *txn,
 										 int fd, ReorderBufferChange *change);
+static void ReorderBufferCompressChange(ReorderBuffer *rb);
+static void ReorderBufferDecompressChange(ReorderBuffer *rb);
 static Size ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn,
 										TXNEntryFile *file, XLogSegNo *segno);
 static void ReorderBufferRestoreChange(ReorderBuffer *rb, ReorderBufferTXN *txn,
@@ -380,6 +396,8 @@ ReorderBufferAllocate(void)
 
 	buffer->outbuf = NULL;
 	buffer->outbufsize = 0;
+	buffer->compressbuf = NULL;
+	buffer->compressbufsize = 0;
 	buffer->size = 0;
 
 	/* txn_heap is ordered by transaction size */
@@ -3727,6 +3745,25 @@ ReorderBufferXidHasCatalogChanges(ReorderBuffer *rb, TransactionId xid)
 	return rbtxn_has_catalog_changes(txn);
 }
 
+/*
+ * ReorderBufferXidTopHasCatalogChanges
+ *		Does the top-level transaction of the given txn/subtxn, or any of its
+ *		known subtransactions, contain catalog changes?
+ */
+bool
+ReorderBufferXidTopHasCatalogChanges(ReorderBuffer *rb, TransactionId xid)
+{
+	ReorderBufferTXN *txn;
+
+	txn = ReorderBufferTXNByXid(rb, xid, false, NULL, InvalidXLogRecPtr,
+								false);
+	if (txn == NULL)
+		return false;
+
+	/* ReorderBufferXidSetCatalogChanges propagates the flag to the top */
+	return rbtxn_has_catalog_changes(rbtxn_get_toptxn(txn));
+}
+
 /*
  * ReorderBufferXidHasBaseSnapshot
  *		Have we already set the base snapshot for the given txn/subtxn?
@@ -3777,6 +3814,42 @@ ReorderBufferSerializeReserve(ReorderBuffer *rb, Size sz)
 }
 
 
+#ifdef USE_LZ4
+/*
+ * Ensure the compression buffer is >= sz.
+ */
+static void
+ReorderBufferCompressReserve(ReorderBuffer *rb, Size sz)
+{
+	if (!rb->compressbufsize)
+	{
+		rb->compressbuf = MemoryContextAlloc(rb->context, sz);
+		rb->compressbufsize = sz;
+	}
+	else if (rb->compressbufsize < sz)
+	{
+		rb->compressbuf = repalloc(rb->compressbuf, sz);
+		rb->compressbufsize = sz;
+	}
+}
+
+/*
+ * Swap the IO buffer with the compression buffer, once the latter holds the
+ * (de)compressed version of the former.
+ */
+static void
+ReorderBufferSwapBuffers(ReorderBuffer *rb)
+{
+	char	   *buf = rb->outbuf;
+	Size		bufsize = rb->outbufsize;
+
+	rb->outbuf = rb->compressbuf;
+	rb->outbufsize = rb->compressbufsize;
+	rb->compressbuf = buf;
+	rb->compressbufsize = bufsize;
+}
+#endif
+
 /* Compare two transactions by size */
 static int
 ReorderBufferTXNSizeCompare(const pairingheap_node *a, const pairingheap_node *b, void *arg)
@@ -4263,6 +4336,10 @@ ReorderBufferSerializeChange(ReorderBuffer *rb, ReorderBufferTXN *txn,
 	}
 
 	ondisk->size = sz;
+	ondisk->rawsize = 0;
+
+	ReorderBufferCompressChange(rb);
+	ondisk = (ReorderBufferDiskChange *) rb->outbuf;
 
 	errno = 0;
 	pgstat_report_wait_start(WAIT_EVENT_REORDER_BUFFER_WRITE);
@@ -4295,6 +4372,86 @@ ReorderBufferSerializeChange(ReorderBuffer *rb, ReorderBufferTXN *txn,
 	Assert(ondisk->change.action == change->action);
 }
 
+/*
+ * Compress the data part of the change serialized in the IO buffer, if that
+ * is supported and worthwhile.  On success the IO buffer is replaced by one
+ * holding the compressed version, with its header adjusted accordingly.
+ */
+static void
+ReorderBufferCompressChange(ReorderBuffer *rb)
+{
+#ifdef USE_LZ4
+	ReorderBufferDiskChange *ondisk = (ReorderBufferDiskChange *) rb->outbuf;
+	Size		rawsize = ondisk->size - sizeof(ReorderBufferDiskChange);
+	ReorderBufferDiskChange *compressed;
+	int			bound;
+	int			len;
+
+	if (rawsize < SPILL_COMPRESSION_MIN_SIZE || rawsize > LZ4_MAX_INPUT_SIZE)
+		return;
+
+	bound = LZ4_compressBound((int) rawsize);
+	ReorderBufferCompressReserve(rb, sizeof(ReorderBufferDiskChange) + bound);
+
+	len = LZ4_compress_default(rb->outbuf + sizeof(ReorderBufferDiskChange),
+							   rb->compressbuf + sizeof(ReorderBufferDiskChange),
+							   (int) rawsize, bound);
+
+	/* if it failed or didn't save anything, just write it uncompressed */
+	if (len <= 0 || len >= rawsize)
+		return;
+
+	compressed = (ReorderBufferDiskChange *) rb->compressbuf;
+	memcpy(compressed, ondisk, sizeof(ReorderBufferDiskChange));
+	compressed->size = sizeof(ReorderBufferDiskChange) + len;
+	compressed->rawsize = rawsize;
+
+	ReorderBufferSwapBuffers(rb);
+#endif
+}
+
+/*
+ * Decompress the data part of the change read into the IO buffer, if it was
+ * compressed by ReorderBufferCompressChange().
+ */
+static void
+ReorderBufferDecompressChange(ReorderBuffer *rb)
+{
+	ReorderBufferDiskChange *ondisk = (ReorderBufferDiskChange *) rb->outbuf;
+
+	if (ondisk->rawsize == 0)
+		return;
+
+#ifdef USE_LZ4
+	{
+		ReorderBufferDiskChange *decompressed;
+		int			len;
+
+		ReorderBufferCompressReserve(rb,
+									 sizeof(ReorderBufferDiskChange) + ondisk->rawsize);
+
+		len = LZ4_decompress_safe(rb->outbuf + sizeof(ReorderBufferDiskChange),
+								  rb->compressbuf + sizeof(ReorderBufferDiskChange),
+								  ondisk->size - sizeof(ReorderBufferDiskChange),
+								  ondisk->rawsize);
+		if (len < 0 || (Size) len != ondisk->rawsize)
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg_internal("compressed data in reorderbuffer spill file is corrupt")));
+
+		decompressed = (ReorderBufferDiskChange *) rb->compressbuf;
+		memcpy(decompressed, ondisk, sizeof(ReorderBufferDiskChange));
+		decompressed->size = sizeof(ReorderBufferDiskChange) + ondisk->rawsize;
+		decompressed->rawsize = 0;
+
+		ReorderBufferSwapBuffers(rb);
+	}
+#else
+	/* we wrote the file ourselves, so this can't happen */
+	elog(ERROR, "compressed data in reorderbuffer spill file is not supported by this build");
+#endif
+}
+
 /* Returns true, if the output plugin supports streaming, false, otherwise. */
 static inline bool
 ReorderBufferCanStream(ReorderBuffer *rb)
@@ -4661,6 +4818,7 @@ ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn,
 		 * ok, read a full change from disk, now restore it into proper
 		 * in-memory format
 		 */
+		ReorderBufferDecompressChange(rb);
 		ReorderBufferRestoreChange(rb, txn, rb->outbuf);
 		restored++;
 	}
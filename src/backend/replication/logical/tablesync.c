@@ -26,6 +26,14 @@
  *	   - It allows us to synchronize any tables added after the initial
  *		 synchronization has finished.
  *
+ *	  The parallelism is across tables only: each table is copied by a single
+ *	  COPY in one sync worker.  Copying one large table with several workers,
+ *	  say by ctid ranges, would need all of them to read from the snapshot
+ *	  exported with the sync worker's slot (through additional publisher
+ *	  connections importing it), and the single per-table state above would
+ *	  have to track the progress of each range so that a crash doesn't force
+ *	  the whole copy to be redone.
+ *
  *	  The stream position synchronization works in multiple steps:
  *	   - Apply worker requests a tablesync worker to start, setting the new
  *		 table state to INIT.
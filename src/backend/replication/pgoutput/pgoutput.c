@@ -58,6 +58,8 @@ static void pgoutput_message(LogicalDecodingContext *ctx,
 							 ReorderBufferTXN *txn, XLogRecPtr message_lsn,
 							 bool transactional, const char *prefix,
 							 Size sz, const char *message);
+static bool pgoutput_relation_filter(LogicalDecodingContext *ctx,
+									 Relation relation);
 static bool pgoutput_origin_filter(LogicalDecodingContext *ctx,
 								   ReplOriginId origin_id);
 static void pgoutput_begin_prepare_txn(LogicalDecodingContext *ctx,
@@ -272,6 +274,7 @@ _PG_output_plugin_init(OutputPluginCallbacks *cb)
 	cb->commit_prepared_cb = pgoutput_commit_prepared_txn;
 	cb->rollback_prepared_cb = pgoutput_rollback_prepared_txn;
 	cb->filter_by_origin_cb = pgoutput_origin_filter;
+	cb->filter_by_relation_cb = pgoutput_relation_filter;
 	cb->shutdown_cb = pgoutput_shutdown;
 
 	/* transaction streaming */
@@ -1777,6 +1780,81 @@ pgoutput_origin_filter(LogicalDecodingContext *ctx,
 	return false;
 }
 
+/*
+ * Return true if no change to the relation can be published, because it is
+ * not a member of any of our publications, false otherwise.
+ *
+ * This is called while the WAL is decoded, not when the transaction is
+ * replayed, so it must not use RelationSyncCache or data->publications: those
+ * would then hold the catalog state as of this change, and could be used for
+ * changes of transactions that are replayed later but made their changes
+ * earlier, when the relation might still have been published.  Instead, look
+ * the publications up afresh.
+ *
+ * We only need to be sure when we say a change cannot be published, so this
+ * errs on the side of publishing: it ignores EXCEPT clauses, and treats a
+ * publication that does not exist yet as publishing everything.  Row filters
+ * and column lists are left to pgoutput_change().
+ */
+static bool
+pgoutput_relation_filter(LogicalDecodingContext *ctx, Relation relation)
+{
+	PGOutputData *data = (PGOutputData *) ctx->output_plugin_private;
+	Oid			relid = RelationGetRelid(relation);
+	List	   *pubids;
+	List	   *schemaPubids;
+	List	   *ancestors = NIL;
+	ListCell   *lc;
+	bool		filtered = true;
+
+	/* nothing to go by while creating the slot */
+	if (data->publication_names == NIL)
+		return false;
+
+	if (!is_publishable_relation(relation))
+		return true;
+
+	pubids = GetRelationIncludedPublications(relid);
+	schemaPubids = GetSchemaPublications(RelationGetNamespace(relation));
+	if (relation->rd_rel->relispartition)
+		ancestors = get_partition_ancestors(relid);
+
+	foreach(lc, data->publication_names)
+	{
+		char	   *pubname = (char *) lfirst(lc);
+		Publication *pub = GetPublicationByName(pubname, true);
+		int			level;
+
+		if (pub == NULL)
+		{
+			filtered = false;
+			break;
+		}
+
+		if (!pub->pubactions.pubinsert &&
+			!pub->pubactions.pubupdate &&
+			!pub->pubactions.pubdelete)
+			continue;
+
+		if (pub->alltables ||
+			list_member_oid(pubids, pub->oid) ||
+			list_member_oid(schemaPubids, pub->oid) ||
+			(ancestors != NIL &&
+			 OidIsValid(GetTopMostAncestorInPublication(pub->oid, ancestors,
+														&level))))
+		{
+			filtered = false;
+			break;
+		}
+	}
+
+	list_free(pubids);
+	list_free(schemaPubids);
+	list_free(ancestors);
+
+	return filtered;
+}
+
 /*
  * Shutdown the output plugin.
  *
@@ -90,6 +90,7 @@
 int			wal_receiver_status_interval;
 int			wal_receiver_timeout;
 bool		hot_standby_feedback;
+int			wal_receiver_compression = WAL_RCV_COMPRESSION_OFF;
 
 /* libpqwalreceiver connection */
 static WalReceiverConn *wrconn = NULL;
@@ -394,6 +395,8 @@ WalReceiverMain(const void *startup_data, size_t startup_data_len)
 		options.startpoint = startpoint;
 		options.slotname = slotname[0] != '\0' ? slotname : NULL;
 		options.proto.physical.startpointTLI = startpointTLI;
+		options.proto.physical.compression =
+			(wal_receiver_compression == WAL_RCV_COMPRESSION_LZ4) ? "lz4" : NULL;
 		if (walrcv_startstreaming(wrconn, &options))
 		{
 			if (first_stream)
@@ -51,6 +51,10 @@
 #include <signal.h>
 #include <unistd.h>
 
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
+
 #include "access/timeline.h"
 #include "access/transam.h"
 #include "access/twophase.h"
@@ -194,6 +198,14 @@ static StringInfoData output_message;
 static StringInfoData reply_message;
 static StringInfoData tmpbuf;
 
+/*
+ * Did the client of a physical replication stream ask for the WAL data to be
+ * compressed?  If so, compressed_message holds the compressed version of
+ * output_message.
+ */
+static bool wal_stream_compression = false;
+static StringInfoData compressed_message;
+
 /* Timestamp of last ProcessRepliesIfAny(). */
 static TimestampTz last_processing = 0;
 
@@ -288,6 +300,7 @@ static void InitWalSenderSlot(void);
 static void WalSndKill(int code, Datum arg);
 pg_noreturn static void WalSndShutdown(void);
 static void XLogSendPhysical(void);
+static bool WalSndCompressWALData(void);
 static void XLogSendLogical(void);
 pg_noreturn static void WalSndDoneImmediate(void);
 static void WalSndDone(WalSndSendDataCallback send_data);
@@ -299,6 +312,7 @@ static void ReadReplicationSlot(ReadReplicationSlotCmd *cmd);
 static void CreateReplicationSlot(CreateReplicationSlotCmd *cmd);
 static void DropReplicationSlot(DropReplicationSlotCmd *cmd);
 static void StartReplication(StartReplicationCmd *cmd);
+static void parseStartReplicationOptions(StartReplicationCmd *cmd);
 static void StartLogicalReplication(StartReplicationCmd *cmd);
 static void ProcessStandbyMessage(void);
 static void ProcessStandbyReplyMessage(void);
@@ -850,6 +864,62 @@ HandleUploadManifestPacket(StringInfo buf, off_t *offset,
 	return false;
 }
 
+/*
+ * Process the options given to START_REPLICATION for physical replication.
+ */
+static void
+parseStartReplicationOptions(StartReplicationCmd *cmd)
+{
+	ListCell   *lc;
+	bool		compression_given = false;
+
+	wal_stream_compression = false;
+
+	foreach(lc, cmd->options)
+	{
+		DefElem    *defel = (DefElem *) lfirst(lc);
+
+		if (strcmp(defel->defname, "compression") == 0)
+		{
+			char	   *method;
+
+			if (compression_given)
+				ereport(ERROR,
+						(errcode(ERRCODE_SYNTAX_ERROR),
+						 errmsg("conflicting or redundant options")));
+			compression_given = true;
+
+			method = defGetString(defel);
+			if (strcmp(method, "none") == 0)
+				wal_stream_compression = false;
+			else if (strcmp(method, "lz4") == 0)
+			{
+#ifdef USE_LZ4
+				wal_stream_compression = true;
+#else
+
+				/*
+				 * Compression is only an optimization, so stream uncompressed
+				 * rather than refuse to stream at all.  Otherwise a standby
+				 * asking for lz4 would retry forever.
+				 */
+				ereport(WARNING,
+						(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+						 errmsg("compression method lz4 not supported, streaming WAL uncompressed"),
+						 errdetail("This functionality requires the server to be built with lz4 support.")));
+#endif
+			}
+			else
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+						 errmsg("unrecognized value for %s option \"%s\": \"%s\"",
+								"START_REPLICATION", defel->defname, method)));
+		}
+		else
+			elog(ERROR, "unrecognized option: %s", defel->defname);
+	}
+}
+
 /*
  * Handle START_REPLICATION command.
  *
@@ -863,6 +933,8 @@ StartReplication(StartReplicationCmd *cmd)
 	XLogRecPtr	FlushPtr;
 	TimeLineID	FlushTLI;
 
+	parseStartReplicationOptions(cmd);
+
 	/* create xlogreader for physical replication */
 	xlogreader =
 		XLogReaderAllocate(wal_segment_size, NULL,
@@ -2231,6 +2303,7 @@ exec_replication_command(const char *cmd_string)
 	initStringInfo(&output_message);
 	initStringInfo(&reply_message);
 	initStringInfo(&tmpbuf);
+	initStringInfo(&compressed_message);
 
 	switch (cmd_node->type)
 	{
@@ -3366,6 +3439,7 @@ XLogSendPhysical(void)
 	XLogSegNo	segno;
 	WALReadError errinfo;
 	Size		rbytes;
+	StringInfo	msg;
 
 	/* If requested switch the WAL sender to the stopping state. */
 	if (got_STOPPING)
@@ -3631,15 +3705,21 @@ retry:
 	output_message.len += nbytes;
 	output_message.data[output_message.len] = '\0';
 
+	/* Compress the WAL data, if the client asked for it and it helps */
+	msg = &output_message;
+	if (wal_stream_compression && WalSndCompressWALData())
+		msg = &compressed_message;
+
 	/*
 	 * Fill the send timestamp last, so that it is taken as late as possible.
+	 * It's at the same place in both message types.
 	 */
 	resetStringInfo(&tmpbuf);
 	pq_sendint64(&tmpbuf, GetCurrentTimestamp());
-	memcpy(&output_message.data[1 + sizeof(int64) + sizeof(int64)],
+	memcpy(&msg->data[1 + sizeof(int64) + sizeof(int64)],
 		   tmpbuf.data, sizeof(int64));
 
-	pq_putmessage_noblock(PqMsg_CopyData, output_message.data, output_message.len);
+	pq_putmessage_noblock(PqMsg_CopyData, msg->data, msg->len);
 
 	sentPtr = endptr;
 
@@ -3663,6 +3743,47 @@ retry:
 	}
 }
 
+/*
+ * Build a CompressedWALData message in compressed_message from the WALData
+ * message in output_message.  Returns false, leaving it to the caller to send
+ * the original message, if compression doesn't make the message smaller.
+ */
+static bool
+WalSndCompressWALData(void)
+{
+#ifdef USE_LZ4
+	int			hdrlen = 1 + 3 * sizeof(int64);
+	int			rawlen = output_message.len - hdrlen;
+	int			bound;
+	int			len;
+
+	if (rawlen <= 0)
+		return false;
+
+	resetStringInfo(&compressed_message);
+	pq_sendbyte(&compressed_message, PqReplMsg_CompressedWALData);
+	/* copy dataStart, walEnd and the sendtime placeholder */
+	pq_sendbytes(&compressed_message, &output_message.data[1],
+				 3 * sizeof(int64));
+	pq_sendint32(&compressed_message, rawlen);
+
+	bound = LZ4_compressBound(rawlen);
+	enlargeStringInfo(&compressed_message, bound);
+	len = LZ4_compress_default(&output_message.data[hdrlen],
+							   &compressed_message.data[compressed_message.len],
+							   rawlen, bound);
+	if (len <= 0 || len >= rawlen)
+		return false;
+
+	compressed_message.len += len;
+	compressed_message.data[compressed_message.len] = '\0';
+
+	return true;
+#else
+	return false;
+#endif
+}
+
 /*
  * Stream out logically decoded data.
  */
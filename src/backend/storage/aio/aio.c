@@ -73,6 +73,7 @@ const struct config_enum_entry io_method_options[] = {
 /* GUCs */
 int			io_method = DEFAULT_IO_METHOD;
 int			io_max_concurrency = -1;
+bool		io_uring_fixed_buffers = false;
 
 /* global control for AIO */
 PgAioCtl   *pgaio_ctl;
@@ -36,6 +36,7 @@
 
 #include "miscadmin.h"
 #include "storage/aio_internal.h"
+#include "storage/bufmgr.h"
 #include "storage/fd.h"
 #include "storage/proc.h"
 #include "storage/shmem.h"
@@ -98,9 +99,22 @@ typedef struct PgAioUringContext
 	 */
 	LWLock		completion_lock;
 
+	/*
+	 * Whether shared buffers have been registered with io_uring_ring, and
+	 * whether that has been attempted.  See pgaio_uring_init_backend().
+	 */
+	bool		fixed_buffers_tried;
+	bool		fixed_buffers;
+
 	struct io_uring io_uring_ring;
 } PgAioUringContext;
 
+/*
+ * Shared buffers are registered in chunks of this size, as the kernel limits
+ * the size of each registered buffer.  Must be a multiple of BLCKSZ.
+ */
+#define PGAIO_URING_FIXED_BUF_CHUNK ((size_t) 1024 * 1024 * 1024)
+
 /*
  * Information about the capabilities that io_uring has.
  *
@@ -400,15 +414,90 @@ pgaio_uring_shmem_init(void *arg)
 		}
 
 		LWLockInitialize(&context->completion_lock, LWTRANCHE_AIO_URING_COMPLETION);
+		context->fixed_buffers_tried = false;
+		context->fixed_buffers = false;
 	}
 }
 
+/*
+ * Register shared buffers with the current backend's io_uring instance.
+ *
+ * The registration survives the backend, so a later backend using the same
+ * io_uring instance doesn't need to do it again.  But every instance pins and
+ * accounts for all of shared buffers on its own, so the locked memory needed
+ * grows with the number of processes; that's why io_uring_fixed_buffers is
+ * off by default.  Failure isn't fatal, I/O just won't use fixed buffers.
+ */
+static void
+pgaio_uring_register_buffers(PgAioUringContext *context)
+{
+	size_t		total = (size_t) NBuffers * BLCKSZ;
+	int			nchunks = (total + PGAIO_URING_FIXED_BUF_CHUNK - 1) /
+		PGAIO_URING_FIXED_BUF_CHUNK;
+	struct iovec *iovs;
+	int			ret;
+
+	context->fixed_buffers_tried = true;
+
+	iovs = palloc_array(struct iovec, nchunks);
+	for (int i = 0; i < nchunks; i++)
+	{
+		size_t		off = i * PGAIO_URING_FIXED_BUF_CHUNK;
+
+		iovs[i].iov_base = BufferBlocks + off;
+		iovs[i].iov_len = Min(PGAIO_URING_FIXED_BUF_CHUNK, total - off);
+	}
+
+	ret = io_uring_register_buffers(&context->io_uring_ring, iovs, nchunks);
+	pfree(iovs);
+
+	if (ret < 0)
+	{
+		errno = -ret;
+		ereport(LOG,
+				errmsg("could not register shared buffers with io_uring: %m"),
+				-ret == ENOMEM ?
+				errhint("Consider increasing \"ulimit -l\" or disabling \"%s\".",
+						"io_uring_fixed_buffers") : 0);
+		return;
+	}
+
+	context->fixed_buffers = true;
+}
+
+/*
+ * If the IO described by iov can use the registered shared buffers, return
+ * the index of the registered buffer containing it, otherwise -1.
+ */
+static inline int
+pgaio_uring_fixed_buffer_index(const struct iovec *iov)
+{
+	char	   *base = (char *) iov->iov_base;
+	size_t		off;
+
+	if (!pgaio_my_uring_context->fixed_buffers)
+		return -1;
+	if (base < BufferBlocks ||
+		base + iov->iov_len > BufferBlocks + (size_t) NBuffers * BLCKSZ)
+		return -1;
+
+	off = base - BufferBlocks;
+	if (off / PGAIO_URING_FIXED_BUF_CHUNK !=
+		(off + iov->iov_len - 1) / PGAIO_URING_FIXED_BUF_CHUNK)
+		return -1;
+
+	return off / PGAIO_URING_FIXED_BUF_CHUNK;
+}
+
 static void
 pgaio_uring_init_backend(void)
 {
 	Assert(MyProcNumber < pgaio_uring_procs());
 
 	pgaio_my_uring_context = &pgaio_uring_contexts[MyProcNumber];
+
+	if (io_uring_fixed_buffers && !pgaio_my_uring_context->fixed_buffers_tried)
+		pgaio_uring_register_buffers(pgaio_my_uring_context);
 }
 
 static int
@@ -744,12 +833,25 @@ pgaio_uring_sq_from_io(PgAioHandle *ioh, struct io_uring_sqe *sqe)
 {
 	struct iovec *iov;
 	size_t		io_size = 0;
+	int			buf_index;
 
 	switch ((PgAioOp) ioh->op)
 	{
 		case PGAIO_OP_READV:
 			iov = &pgaio_ctl->iovecs[ioh->iovec_off];
-			if (ioh->op_data.read.iov_length == 1)
+			if (ioh->op_data.read.iov_length == 1 &&
+				(buf_index = pgaio_uring_fixed_buffer_index(iov)) >= 0)
+			{
+				io_uring_prep_read_fixed(sqe,
+										 ioh->op_data.read.fd,
+										 iov->iov_base,
+										 iov->iov_len,
+										 ioh->op_data.read.offset,
+										 buf_index);
+
+				io_size = iov->iov_len;
+			}
+			else if (ioh->op_data.read.iov_length == 1)
 			{
 				io_uring_prep_read(sqe,
 								   ioh->op_data.read.fd,
@@ -778,7 +880,17 @@ pgaio_uring_sq_from_io(PgAioHandle *ioh, struct io_uring_sqe *sqe)
 
 		case PGAIO_OP_WRITEV:
 			iov = &pgaio_ctl->iovecs[ioh->iovec_off];
-			if (ioh->op_data.write.iov_length == 1)
+			if (ioh->op_data.write.iov_length == 1 &&
+				(buf_index = pgaio_uring_fixed_buffer_index(iov)) >= 0)
+			{
+				io_uring_prep_write_fixed(sqe,
+										  ioh->op_data.write.fd,
+										  iov->iov_base,
+										  iov->iov_len,
+										  ioh->op_data.write.offset,
+										  buf_index);
+			}
+			else if (ioh->op_data.write.iov_length == 1)
 			{
 				io_uring_prep_write(sqe,
 									ioh->op_data.write.fd,
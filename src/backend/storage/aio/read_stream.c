@@ -118,6 +118,14 @@ struct ReadStream
 	int16		initialized_buffers;
 	int16		resume_readahead_distance;
 	int16		resume_combine_distance;
+
+	/*
+	 * The read-ahead distance this stream has most recently settled on, and
+	 * the tablespace it reads from.  Remembered when the stream ends, see
+	 * read_stream_distance_hints.
+	 */
+	int16		learned_distance;
+	Oid			tablespace_id;
 	int			read_buffers_flags;
 	bool		sync_mode;		/* using io_method=sync */
 	bool		batch_mode;		/* READ_STREAM_USE_BATCHING */
@@ -165,6 +173,25 @@ struct ReadStream
 	Buffer		buffers[FLEXIBLE_ARRAY_MEMBER];
 };
 
+/*
+ * Read-ahead distances that recently ended streams settled on, for a few
+ * tablespaces.  A new stream on the same tablespace starts at half that
+ * distance instead of at 1.  Then a backend that runs many short scans on a
+ * high-latency device doesn't have to ramp up from scratch for every scan,
+ * while the usual feedback from waits and buffer hits still adjusts the
+ * distance from there.
+ */
+#define READ_STREAM_DISTANCE_HINTS 8
+
+typedef struct ReadStreamDistanceHint
+{
+	Oid			tablespace_id;
+	int16		distance;
+} ReadStreamDistanceHint;
+
+static ReadStreamDistanceHint read_stream_distance_hints[READ_STREAM_DISTANCE_HINTS];
+static int	read_stream_distance_hint_next = 0;
+
 /*
  * Return a pointer to the per-buffer data by index.
  */
@@ -467,7 +494,10 @@ read_stream_start_pending_read(ReadStream *stream)
 			else
 			{
 				if (stream->readahead_distance > 1)
+				{
 					stream->readahead_distance--;
+					stream->learned_distance = stream->readahead_distance;
+				}
 
 				/*
 				 * For now we reduce the IO combine distance after
@@ -947,7 +977,22 @@ read_stream_begin_impl(int flags,
 	{
 		stream->readahead_distance = 1;
 		stream->combine_distance = 1;
+
+		/* Start from what recent streams on this tablespace needed */
+		for (int i = 0; i < READ_STREAM_DISTANCE_HINTS; i++)
+		{
+			ReadStreamDistanceHint *hint = &read_stream_distance_hints[i];
+
+			if (hint->tablespace_id == tablespace_id && hint->distance > 1)
+			{
+				stream->readahead_distance =
+					Min(max_pinned_buffers, Max(1, hint->distance / 2));
+				break;
+			}
+		}
 	}
+	stream->tablespace_id = tablespace_id;
+	stream->learned_distance = 0;
 	stream->resume_readahead_distance = stream->readahead_distance;
 	stream->resume_combine_distance = stream->combine_distance;
 
@@ -1234,6 +1279,7 @@ read_stream_next_buffer(ReadStream *stream, void **per_buffer_data)
 			readahead_distance = stream->readahead_distance * 2;
 			readahead_distance = Min(readahead_distance, stream->max_pinned_buffers);
 			stream->readahead_distance = readahead_distance;
+			stream->learned_distance = readahead_distance;
 		}
 
 		/*
@@ -1466,6 +1512,30 @@ read_stream_reset(ReadStream *stream)
 void
 read_stream_end(ReadStream *stream)
 {
+	/* Remember how far this stream needed to look ahead, if it learned that */
+	if (stream->learned_distance > 0)
+	{
+		ReadStreamDistanceHint *hint = NULL;
+
+		for (int i = 0; i < READ_STREAM_DISTANCE_HINTS; i++)
+		{
+			if (read_stream_distance_hints[i].tablespace_id ==
+				stream->tablespace_id)
+			{
+				hint = &read_stream_distance_hints[i];
+				break;
+			}
+		}
+		if (hint == NULL)
+		{
+			hint = &read_stream_distance_hints[read_stream_distance_hint_next];
+			read_stream_distance_hint_next =
+				(read_stream_distance_hint_next + 1) % READ_STREAM_DISTANCE_HINTS;
+			hint->tablespace_id = stream->tablespace_id;
+		}
+		hint->distance = stream->learned_distance;
+	}
+
 	read_stream_reset(stream);
 	pfree(stream);
 }
@@ -121,6 +121,15 @@ BufferManagerShmemInit(void *arg)
 {
 	/*
 	 * Initialize all the buffer headers.
+	 *
+	 * This writes every descriptor and I/O condition variable, which is what
+	 * faults in that part of shared memory, and thus takes time proportional
+	 * to shared_buffers.  The buffer blocks themselves are not touched here;
+	 * they are faulted in on first use, unless the kernel populates huge
+	 * pages at allocation time.  Initializing descriptors lazily would mean
+	 * checking for an uninitialized descriptor in the clock sweep and in
+	 * every other scan over all buffers (checkpoints, DropRelationBuffers()
+	 * etc.), so we pay the cost once, before any backend can attach.
 	 */
 	for (int i = 0; i < NBuffers; i++)
 	{
@@ -64,6 +64,7 @@
 #include "storage/read_stream.h"
 #include "storage/smgr.h"
 #include "storage/standby.h"
+#include "utils/injection_point.h"
 #include "utils/memdebug.h"
 #include "utils/ps_status.h"
 #include "utils/rel.h"
@@ -227,6 +228,32 @@ int			backend_flush_after = DEFAULT_BACKEND_FLUSH_AFTER;
 /* local state for LockBufferForCleanup */
 static BufferDesc *PinCountWaitBuf = NULL;
 
+/*
+ * Backend-local cache of recent shared buffer mapping lookups.
+ *
+ * BufferAlloc() consults this direct-mapped cache, indexed by the tag's hash
+ * code, before searching the shared buffer mapping table.  On a cache hit we
+ * pin the remembered buffer without acquiring the BufMappingLock partition
+ * lock, and then check that the buffer still holds the wanted page, the same
+ * way ReadRecentBuffer() does.  Entries can be arbitrarily out of date; a
+ * stale entry just makes us fall back to the regular lookup.  Frequently
+ * accessed pages, like the upper levels of indexes, thus avoid the atomic
+ * operations on shared partition locks that otherwise serialize many-core
+ * read workloads.
+ */
+#define BUF_LOOKASIDE_SIZE 256	/* must be a power of 2 */
+
+typedef struct BufLookasideEntry
+{
+	BufferTag	tag;
+	int			buf_id;
+} BufLookasideEntry;
+
+static BufLookasideEntry BufLookaside[BUF_LOOKASIDE_SIZE];
+
+#define BufLookasideSlot(hashcode) \
+	(&BufLookaside[(hashcode) & (BUF_LOOKASIDE_SIZE - 1)])
+
 /*
  * Backend-Private refcount management:
  *
@@ -636,6 +663,8 @@ static void UnpinBufferNoOwner(BufferDesc *buf);
 static void BufferSync(int flags);
 static int	SyncOneBuffer(int buf_id, bool skip_recently_used,
 						  WritebackContext *wb_context);
+static int	SyncBufferRun(CkptSortItem *items, int nitems,
+						  WritebackContext *wb_context, int *nwritten);
 static void WaitIO(BufferDesc *buf);
 static void AbortBufferIO(Buffer buffer);
 static void shared_buffer_write_error_callback(void *arg);
@@ -2207,6 +2236,7 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	BufferDesc *victim_buf_hdr;
 	uint64		victim_buf_state;
 	uint64		set_bits = 0;
+	BufLookasideEntry *lookaside;
 
 	/* Make sure we will have room to remember the buffer pin */
 	ResourceOwnerEnlarge(CurrentResourceOwner);
@@ -2218,6 +2248,47 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	/* determine its hash code and partition lock ID */
 	newHash = BufTableHashCode(&newTag);
 	newPartitionLock = BufMappingPartitionLock(newHash);
+	lookaside = BufLookasideSlot(newHash);
+
+	/*
+	 * Try the buffer we found for this tag last time, without taking the
+	 * mapping lock.  A buffer's tag can't change while it's pinned, so if
+	 * the tag still matches once we hold a pin, it's the buffer the mapping
+	 * table would have given us; that's the same reasoning as in
+	 * ReadRecentBuffer().  The unlocked tag comparison before pinning merely
+	 * avoids bumping the usage count of unrelated buffers.
+	 */
+	if (BufferTagsEqual(&lookaside->tag, &newTag))
+	{
+		BufferDesc *buf = GetBufferDescriptor(lookaside->buf_id);
+
+		if (BufferTagsEqual(&buf->tag, &newTag))
+		{
+			bool		valid;
+
+			INJECTION_POINT("buffer-lookaside-before-pin", NULL);
+
+			valid = PinBuffer(buf, strategy, false);
+
+			if ((pg_atomic_read_u64(&buf->state) & BM_TAG_VALID) &&
+				BufferTagsEqual(&buf->tag, &newTag))
+			{
+				/* see comments below about !valid */
+				*foundPtr = valid;
+				return buf;
+			}
+			UnpinBuffer(buf);
+
+			/*
+			 * PinBuffer() used up the refcount entry we reserved above, so
+			 * reserve another one for the regular lookup below.
+			 */
+			ResourceOwnerEnlarge(CurrentResourceOwner);
+			ReservePrivateRefCountEntry();
+		}
+
+		INJECTION_POINT("buffer-lookaside-stale", NULL);
+	}
 
 	/* see if the block is in the buffer pool already */
 	LWLockAcquire(newPartitionLock, LW_SHARED);
@@ -2239,6 +2310,10 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 		/* Can release the mapping lock as soon as we've pinned it */
 		LWLockRelease(newPartitionLock);
 
+		/* Remember the buffer, to skip the mapping lock next time */
+		lookaside->tag = newTag;
+		lookaside->buf_id = existing_buf_id;
+
 		*foundPtr = true;
 
 		if (!valid)
@@ -2342,6 +2417,9 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 
 	LWLockRelease(newPartitionLock);
 
+	lookaside->tag = newTag;
+	lookaside->buf_id = victim_buf_hdr->buf_id;
+
 	/*
 	 * Buffer contents are currently invalid.
 	 */
@@ -3763,14 +3841,13 @@ BufferSync(int flags)
 		BufferDesc *bufHdr = NULL;
 		CkptTsStatus *ts_stat = (CkptTsStatus *)
 			DatumGetPointer(binaryheap_first(ts_heap));
+		int			nitems;
 
 		buf_id = CkptBufferIds[ts_stat->index].buf_id;
 		Assert(buf_id != -1);
 
 		bufHdr = GetBufferDescriptor(buf_id);
 
-		num_processed++;
-
 		/*
 		 * We don't need to acquire the lock here, because we're only looking
 		 * at a single bit. It's possible that someone else writes the buffer
@@ -3783,23 +3860,32 @@ BufferSync(int flags)
 		 * write the buffer though we didn't need to.  It doesn't seem worth
 		 * guarding against this, though.
 		 */
+		nitems = 1;
 		if (pg_atomic_read_u64(&bufHdr->state) & BM_CHECKPOINT_NEEDED)
 		{
-			if (SyncOneBuffer(buf_id, false, &wb_context) & BUF_WRITTEN)
-			{
-				TRACE_POSTGRESQL_BUFFER_SYNC_WRITTEN(buf_id);
-				PendingCheckpointerStats.buffers_written++;
-				num_written++;
-			}
+			int			nwritten;
+
+			/*
+			 * Write the buffer, along with any following ones holding the
+			 * next blocks of the same relation, in one go.
+			 */
+			nitems = SyncBufferRun(&CkptBufferIds[ts_stat->index],
+								   ts_stat->num_to_scan - ts_stat->num_scanned,
+								   &wb_context, &nwritten);
+			for (int j = 0; j < nwritten; j++)
+				TRACE_POSTGRESQL_BUFFER_SYNC_WRITTEN(CkptBufferIds[ts_stat->index + j].buf_id);
+			PendingCheckpointerStats.buffers_written += nwritten;
+			num_written += nwritten;
 		}
 
 		/*
 		 * Measure progress independent of actually having to flush the buffer
 		 * - otherwise writing become unbalanced.
 		 */
-		ts_stat->progress += ts_stat->progress_slice;
-		ts_stat->num_scanned++;
-		ts_stat->index++;
+		num_processed += nitems;
+		ts_stat->progress += ts_stat->progress_slice * nitems;
+		ts_stat->num_scanned += nitems;
+		ts_stat->index += nitems;
 
 		/* Have all the buffers from the tablespace been processed? */
 		if (ts_stat->num_scanned == ts_stat->num_to_scan)
@@ -4211,6 +4297,188 @@ SyncOneBuffer(int buf_id, bool skip_recently_used, WritebackContext *wb_context)
 	return result | BUF_WRITTEN;
 }
 
+/*
+ * SyncBufferRun -- write out a run of buffers for BufferSync
+ *
+ * 'items' are the next 'nitems' entries of one tablespace's part of
+ * CkptBufferIds.  As with SyncOneBuffer(), the first buffer is written if
+ * it's dirty.  Following entries are written along with it, in a single
+ * vectored write of up to io_combine_limit blocks, as long as they hold the
+ * next consecutive blocks of the same relation fork, still need a checkpoint
+ * write, and can be locked and have their I/O started without waiting.  We
+ * must not wait for those, since we already hold locks on earlier buffers.
+ *
+ * Returns the number of entries processed, which is at least one, and sets
+ * *nwritten to the number of buffers written.
+ */
+static int
+SyncBufferRun(CkptSortItem *items, int nitems, WritebackContext *wb_context,
+			  int *nwritten)
+{
+	BufferDesc *bufs[MAX_IO_COMBINE_LIMIT];
+	const void *blocks[MAX_IO_COMBINE_LIMIT];
+	BufferTag	tag;
+	SMgrRelation reln;
+	XLogRecPtr	recptr = InvalidXLogRecPtr;
+	ErrorContextCallback errcallback;
+	instr_time	io_start;
+	int			nbufs = 0;
+	int			limit = Min(nitems, io_combine_limit);
+
+	*nwritten = 0;
+	memset(&tag, 0, sizeof(tag));
+
+	for (int i = 0; i < limit; i++)
+	{
+		BufferDesc *bufHdr = GetBufferDescriptor(items[i].buf_id);
+		Buffer		buffer = BufferDescriptorGetBuffer(bufHdr);
+		uint64		buf_state;
+
+		if (i > 0)
+		{
+			BufferTag	expected;
+
+			/* Cheap checks on the sort keys before touching the buffer */
+			if (items[i].relNumber != items[0].relNumber ||
+				items[i].forkNum != items[0].forkNum ||
+				items[i].blockNum != tag.blockNum + i ||
+				!(pg_atomic_read_u64(&bufHdr->state) & BM_CHECKPOINT_NEEDED))
+				break;
+
+			ReservePrivateRefCountEntry();
+			ResourceOwnerEnlarge(CurrentResourceOwner);
+
+			buf_state = LockBufHdr(bufHdr);
+			if (!(buf_state & BM_VALID) || !(buf_state & BM_DIRTY))
+			{
+				UnlockBufHdr(bufHdr);
+				break;
+			}
+			PinBuffer_Locked(bufHdr);
+
+			/* Now that it's pinned, the buffer can't be retagged */
+			expected = tag;
+			expected.blockNum = tag.blockNum + i;
+			if (!BufferTagsEqual(&bufHdr->tag, &expected))
+			{
+				UnpinBuffer(bufHdr);
+				break;
+			}
+
+			if (!BufferLockConditional(buffer, bufHdr,
+									   BUFFER_LOCK_SHARE_EXCLUSIVE))
+			{
+				UnpinBuffer(bufHdr);
+				break;
+			}
+			if (StartSharedBufferIO(bufHdr, false, false, NULL) !=
+				BUFFER_IO_READY_FOR_IO)
+			{
+				BufferLockUnlock(buffer, bufHdr);
+				UnpinBuffer(bufHdr);
+				break;
+			}
+		}
+		else
+		{
+			ReservePrivateRefCountEntry();
+			ResourceOwnerEnlarge(CurrentResourceOwner);
+
+			buf_state = LockBufHdr(bufHdr);
+			if (!(buf_state & BM_VALID) || !(buf_state & BM_DIRTY))
+			{
+				/* It's clean, so nothing to do */
+				UnlockBufHdr(bufHdr);
+				return 1;
+			}
+			PinBuffer_Locked(bufHdr);
+			tag = bufHdr->tag;
+
+			BufferLockAcquire(buffer, bufHdr, BUFFER_LOCK_SHARE_EXCLUSIVE);
+			if (StartSharedBufferIO(bufHdr, false, true, NULL) ==
+				BUFFER_IO_ALREADY_DONE)
+			{
+				/* Someone else flushed it before we could */
+				BufferLockUnlock(buffer, bufHdr);
+				UnpinBuffer(bufHdr);
+				return 1;
+			}
+		}
+
+		/*
+		 * As we hold at least a share-exclusive lock on the buffer, the LSN
+		 * cannot change during the flush.  See FlushBuffer() about why
+		 * non-permanent buffers are skipped.
+		 */
+		if ((pg_atomic_read_u64(&bufHdr->state) & BM_PERMANENT) &&
+			BufferGetLSN(bufHdr) > recptr)
+			recptr = BufferGetLSN(bufHdr);
+
+		bufs[nbufs++] = bufHdr;
+	}
+
+	/* Setup error traceback support for ereport() */
+	errcallback.callback = shared_buffer_write_error_callback;
+	errcallback.arg = bufs[0];
+	errcallback.previous = error_context_stack;
+	error_context_stack = &errcallback;
+
+	reln = smgropen(BufTagGetRelFileLocator(&tag), INVALID_PROC_NUMBER);
+
+	for (int i = 0; i < nbufs; i++)
+		TRACE_POSTGRESQL_BUFFER_FLUSH_START(BufTagGetForkNum(&tag),
+											tag.blockNum + i,
+											reln->smgr_rlocator.locator.spcOid,
+											reln->smgr_rlocator.locator.dbOid,
+											reln->smgr_rlocator.locator.relNumber);
+
+	/* Obey the WAL-before-data rule for the whole run at once */
+	if (XLogRecPtrIsValid(recptr))
+		XLogFlush(recptr);
+
+	for (int i = 0; i < nbufs; i++)
+	{
+		blocks[i] = BufHdrGetBlock(bufs[i]);
+		PageSetChecksum((Page) blocks[i], tag.blockNum + i);
+	}
+
+	io_start = pgstat_prepare_io_time(track_io_timing);
+
+	smgrwritev(reln, BufTagGetForkNum(&tag), tag.blockNum, blocks, nbufs,
+			   false);
+
+	pgstat_count_io_op_time(IOOBJECT_RELATION, IOCONTEXT_NORMAL,
+							IOOP_WRITE, io_start, nbufs, nbufs * BLCKSZ);
+
+	pgBufferUsage.shared_blks_written += nbufs;
+
+	for (int i = 0; i < nbufs; i++)
+	{
+		BufferDesc *bufHdr = bufs[i];
+		BufferTag	buftag = bufHdr->tag;
+
+		TerminateBufferIO(bufHdr, true, 0, true, false);
+
+		TRACE_POSTGRESQL_BUFFER_FLUSH_DONE(BufTagGetForkNum(&buftag),
+										   buftag.blockNum,
+										   reln->smgr_rlocator.locator.spcOid,
+										   reln->smgr_rlocator.locator.dbOid,
+										   reln->smgr_rlocator.locator.relNumber);
+
+		BufferLockUnlock(BufferDescriptorGetBuffer(bufHdr), bufHdr);
+		UnpinBuffer(bufHdr);
+
+		/* Only checkpointer calls this, so IOContext is always normal */
+		ScheduleBufferTagForWriteback(wb_context, IOCONTEXT_NORMAL, &buftag);
+	}
+
+	/* Pop the error context stack */
+	error_context_stack = errcallback.previous;
+
+	*nwritten = nbufs;
+	return nbufs;
+}
+
 /*
  *		AtEOXact_Buffers - clean up at end of transaction.
  *
@@ -59,6 +59,7 @@ static int	NLocalPinnedBuffers = 0;
 static void InitLocalBuffers(void);
 static Block GetLocalBufferStorage(void);
 static Buffer GetLocalVictimBuffer(void);
+static void FlushLocalBufferRun(BufferDesc *bufHdr);
 
 
 /*
@@ -221,6 +222,98 @@ FlushLocalBuffer(BufferDesc *bufHdr, SMgrRelation reln)
 	pgBufferUsage.local_blks_written++;
 }
 
+/*
+ * FlushLocalBufferRun -- write out a dirty victim buffer, combined with
+ * dirty neighbors
+ *
+ * When the clock sweep has to write out a dirty buffer, the following blocks
+ * of the same relation fork are frequently dirty and about to be evicted as
+ * well, e.g. while a large temporary table is being populated.  Instead of
+ * issuing one write per block, collect up to io_combine_limit such
+ * consecutive blocks and write them with a single smgrwritev() call.  Only
+ * neighbors that are unpinned and have a zero usage count are included, as
+ * those are the ones the clock sweep would pick next anyway; they stay valid
+ * in the buffer pool, just clean.
+ *
+ * The caller must hold a pin on bufHdr.
+ */
+static void
+FlushLocalBufferRun(BufferDesc *bufHdr)
+{
+	BufferDesc *run[MAX_IO_COMBINE_LIMIT];
+	const void *pages[MAX_IO_COMBINE_LIMIT];
+	BufferTag	tag = bufHdr->tag;
+	int			nblocks = 1;
+	SMgrRelation reln;
+	instr_time	io_start;
+
+	if (io_combine_limit <= 1)
+	{
+		FlushLocalBuffer(bufHdr, NULL);
+		return;
+	}
+
+	Assert(LocalRefCount[-BufferDescriptorGetBuffer(bufHdr) - 1] > 0);
+
+	if (StartLocalBufferIO(bufHdr, false, true, NULL) != BUFFER_IO_READY_FOR_IO)
+		elog(ERROR, "failed to start write IO on local buffer");
+	run[0] = bufHdr;
+
+	while (nblocks < io_combine_limit &&
+		   tag.blockNum + nblocks != InvalidBlockNumber)
+	{
+		BufferTag	next_tag = tag;
+		LocalBufferLookupEnt *hresult;
+		BufferDesc *next_hdr;
+		uint64		buf_state;
+
+		next_tag.blockNum += nblocks;
+		hresult = (LocalBufferLookupEnt *)
+			hash_search(LocalBufHash, &next_tag, HASH_FIND, NULL);
+		if (!hresult)
+			break;
+
+		next_hdr = GetLocalBufferDescriptor(hresult->id);
+		buf_state = pg_atomic_read_u64(&next_hdr->state);
+		if (LocalRefCount[hresult->id] != 0 ||
+			BUF_STATE_GET_REFCOUNT(buf_state) != 0 ||
+			BUF_STATE_GET_USAGECOUNT(buf_state) != 0 ||
+			!(buf_state & BM_DIRTY) ||
+			pgaio_wref_valid(&next_hdr->io_wref))
+			break;
+
+		if (StartLocalBufferIO(next_hdr, false, false, NULL) != BUFFER_IO_READY_FOR_IO)
+			break;
+
+		run[nblocks++] = next_hdr;
+	}
+
+	reln = smgropen(BufTagGetRelFileLocator(&tag), MyProcNumber);
+
+	for (int i = 0; i < nblocks; i++)
+	{
+		Page		localpage = (char *) LocalBufHdrGetBlock(run[i]);
+
+		PageSetChecksum(localpage, tag.blockNum + i);
+		pages[i] = localpage;
+	}
+
+	io_start = pgstat_prepare_io_time(track_io_timing);
+
+	smgrwritev(reln, BufTagGetForkNum(&tag), tag.blockNum,
+			   pages, nblocks, false);
+
+	/* Temporary table I/O does not use Buffer Access Strategies */
+	pgstat_count_io_op_time(IOOBJECT_TEMP_RELATION, IOCONTEXT_NORMAL,
+							IOOP_WRITE, io_start, 1, nblocks * BLCKSZ);
+
+	/* Mark not-dirty */
+	for (int i = 0; i < nblocks; i++)
+		TerminateLocalBufferIO(run[i], true, 0, false);
+
+	pgBufferUsage.local_blks_written += nblocks;
+}
+
 static Buffer
 GetLocalVictimBuffer(void)
 {
@@ -288,7 +381,7 @@ GetLocalVictimBuffer(void)
 	 * the case, write it out before reusing it!
 	 */
 	if (pg_atomic_read_u64(&bufHdr->state) & BM_DIRTY)
-		FlushLocalBuffer(bufHdr, NULL);
+		FlushLocalBufferRun(bufHdr);
 
 	/*
 	 * Remove the victim buffer from the hashtable and mark as invalid.
@@ -860,6 +860,28 @@ BufFileSeekBlock(BufFile *file, int64 blknum)
 					   SEEK_SET);
 }
 
+/*
+ * BufFilePrefetchBlock --- hint that a block will soon be read
+ *
+ * Asks the kernel to start reading the n'th BLCKSZ-sized block of the file,
+ * so that a later BufFileSeekBlock() and read of it need not wait for the
+ * I/O.  This is only a hint: it does not move the logical position, and is a
+ * no-op if the block is beyond the end of the file or the platform lacks
+ * support for prefetching.
+ */
+void
+BufFilePrefetchBlock(BufFile *file, int64 blknum)
+{
+	int			fileno = (int) (blknum / BUFFILE_SEG_SIZE);
+	pgoff_t		offset = (pgoff_t) (blknum % BUFFILE_SEG_SIZE) * BLCKSZ;
+
+	if (fileno < 0 || fileno >= file->numFiles)
+		return;
+
+	(void) FilePrefetch(file->files[fileno], offset, BLCKSZ,
+						WAIT_EVENT_BUFFILE_READ);
+}
+
 /*
  * Returns the amount of data in the given BufFile, in bytes.
  *
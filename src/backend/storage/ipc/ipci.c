@@ -16,6 +16,7 @@
 
 #include "miscadmin.h"
 #include "pgstat.h"
+#include "port/pg_numa.h"
 #include "storage/dsm.h"
 #include "storage/ipc.h"
 #include "storage/lock.h"
@@ -24,6 +25,7 @@
 #include "storage/shmem_internal.h"
 #include "storage/subsystems.h"
 #include "utils/guc.h"
+#include "utils/guc_hooks.h"
 
 /* GUCs */
 int			shared_memory_type = DEFAULT_SHARED_MEMORY_TYPE;
@@ -141,6 +143,23 @@ CreateSharedMemoryAndSemaphores(void)
 	Assert(strcmp("unknown",
 				  GetConfigOption("huge_pages_status", false, false)) != 0);
 
+	/*
+	 * Spread the segment over all NUMA nodes if requested.  This has to
+	 * happen before the memory is first touched, which is mostly while
+	 * initializing the shmem areas below.  Otherwise, all of shared memory
+	 * tends to end up on the postmaster's node, making most buffer accesses
+	 * from other nodes remote.
+	 */
+	if (numa_interleave)
+	{
+		if (pg_numa_init() == -1)
+			ereport(LOG,
+					(errmsg("NUMA is not available on this system, shared memory will not be interleaved")));
+		else if (pg_numa_interleave_memory(seghdr, seghdr->totalsize) != 0)
+			ereport(LOG,
+					(errmsg("could not interleave shared memory across NUMA nodes: %m")));
+	}
+
 	/*
 	 * Set up shared memory allocation mechanism
 	 */
@@ -221,3 +240,20 @@ InitializeShmemGUCs(void)
 	sprintf(buf, "%d", ProcGlobalSemas());
 	SetConfigOption("num_os_semaphores", buf, PGC_INTERNAL, PGC_S_DYNAMIC_DEFAULT);
 }
+
+/*
+ * GUC check_hook for numa_interleave
+ */
+bool
+check_numa_interleave(bool *newval, void **extra, GucSource source)
+{
+#ifndef USE_LIBNUMA
+	if (*newval)
+	{
+		GUC_check_errdetail("\"%s\" is not supported by this build.",
+							"numa_interleave");
+		return false;
+	}
+#endif
+	return true;
+}
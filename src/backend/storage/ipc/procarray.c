@@ -72,6 +72,12 @@
 
 #define UINT32_ACCESS_ONCE(var)		 ((uint32)(*((volatile uint32 *)&(var))))
 
+/*
+ * Number of dense xids[] entries GetSnapshotData() checks at once when
+ * skipping over backends with no XID assigned.
+ */
+#define SNAPSHOT_XID_SKIP_GROUP	8
+
 /* Our shared memory area */
 typedef struct ProcArrayStruct
 {
@@ -2219,10 +2225,31 @@ GetSnapshotData(Snapshot snapshot)
 		 */
 		for (int pgxactoff = 0; pgxactoff < numProcs; pgxactoff++)
 		{
-			/* Fetch xid just once - see GetNewTransactionId */
-			TransactionId xid = UINT32_ACCESS_ONCE(other_xids[pgxactoff]);
+			TransactionId xid;
 			uint8		statusFlags;
 
+			/*
+			 * With many connections, most entries typically have no XID
+			 * assigned.  Skip over groups of such entries without examining
+			 * them one at a time.  An XID assigned concurrently is necessarily
+			 * >= xmax, so it doesn't matter if we miss it.
+			 */
+			while (pgxactoff + SNAPSHOT_XID_SKIP_GROUP <= numProcs)
+			{
+				TransactionId any = InvalidTransactionId;
+
+				for (int i = 0; i < SNAPSHOT_XID_SKIP_GROUP; i++)
+					any |= other_xids[pgxactoff + i];
+				if (any != InvalidTransactionId)
+					break;
+				pgxactoff += SNAPSHOT_XID_SKIP_GROUP;
+			}
+			if (pgxactoff >= numProcs)
+				break;
+
+			/* Fetch xid just once - see GetNewTransactionId */
+			xid = UINT32_ACCESS_ONCE(other_xids[pgxactoff]);
+
 			Assert(allProcs[arrayP->pgprocnos[pgxactoff]].pgxactoff == pgxactoff);
 
 			/*
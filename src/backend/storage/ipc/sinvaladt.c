@@ -100,6 +100,15 @@
  * readers will see that data after fetching maxMsgNum.  Multiprocessors
  * that have weak memory-ordering guarantees can fail without the memory
  * barrier instructions that are included in the spinlock sequences.
+ *
+ * Every backend reads every message, including those for other databases;
+ * such messages are simply ignored by the receiving code in inval.c, which
+ * is cheap.  Backends are not woken up to do so unless they fall at least
+ * SIG_THRESHOLD messages behind; otherwise they catch up at their next
+ * transaction start.  Splitting the queue by database would reduce the
+ * reading work, but messages about shared catalogs must still go to all
+ * backends in order with the rest, so readers would have to merge two
+ * queues.
  */
 
 
@@ -125,10 +134,16 @@
  * iteration of SIInsertDataEntries.  Noncritical but should be less than
  * CLEANUP_QUANTUM, because we only consider calling SICleanupQueue once
  * per iteration.
+ *
+ * A backend that falls more than MAXNUMMESSAGES behind must reset all its
+ * caches, which is far more expensive than processing the messages it
+ * missed; when many backends are idle during a burst of DDL, they can all
+ * hit that at once.  Each message is only 16 bytes, so the buffer is sized
+ * generously to make such resets rare.
  */
 
-#define MAXNUMMESSAGES 4096
-#define MSGNUMWRAPAROUND (MAXNUMMESSAGES * 262144)
+#define MAXNUMMESSAGES 8192
+#define MSGNUMWRAPAROUND (MAXNUMMESSAGES * 131072)
 #define CLEANUP_MIN (MAXNUMMESSAGES / 2)
 #define CLEANUP_QUANTUM (MAXNUMMESSAGES / 16)
 #define SIG_THRESHOLD (MAXNUMMESSAGES / 2)
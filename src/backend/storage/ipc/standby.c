@@ -465,6 +465,18 @@ ResolveRecoveryConflictWithVirtualXIDs(VirtualTransactionId *waitlist,
  * granular recovery conflicts.  Note that InvalidTransactionId values are
  * interpreted as "definitely don't need any conflicts" here, which is a
  * general convention that WAL records can (and often do) depend on.
+ *
+ * Cancelling the conflicting queries (after max_standby_streaming_delay) is
+ * the only option we have, because replay modifies pages in place: once a
+ * prune or freeze record has been applied, the tuple versions an older
+ * snapshot needs are gone from shared buffers and from disk.  Keeping the
+ * pre-replay images of such pages in a bounded local cache, keyed by page and
+ * LSN, so that old snapshots could read them instead, has been suggested.
+ * It would need every heap and index scan to consult that cache when the
+ * page LSN is newer than the snapshot, and some way to decide which images
+ * an index scan expects.  Old snapshots would also still be cancelled once
+ * the budget ran out.  For now hot_standby_feedback, which moves the cost to
+ * bloat on the primary, remains the alternative.
  */
 void
 ResolveRecoveryConflictWithSnapshot(TransactionId snapshotConflictHorizon,
@@ -41,6 +41,7 @@
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "postmaster/autovacuum.h"
+#include "replication/origin.h"
 #include "replication/slotsync.h"
 #include "replication/syncrep.h"
 #include "storage/condition_variable.h"
@@ -245,6 +246,7 @@ ProcGlobalShmemInit(void *arg)
 	pg_atomic_init_u32(&ProcGlobal->checkpointerProc, INVALID_PROC_NUMBER);
 	pg_atomic_init_u32(&ProcGlobal->procArrayGroupFirst, INVALID_PROC_NUMBER);
 	pg_atomic_init_u32(&ProcGlobal->clogGroupFirst, INVALID_PROC_NUMBER);
+	pg_atomic_init_u32(&ProcGlobal->commitTsGroupFirst, INVALID_PROC_NUMBER);
 
 	ptr = AllProcsShmemPtr;
 	requestSize = ProcGlobalAllProcsShmemSize;
@@ -372,6 +374,7 @@ ProcGlobalShmemInit(void *arg)
 		 */
 		pg_atomic_init_u32(&(proc->procArrayGroupNext), INVALID_PROC_NUMBER);
 		pg_atomic_init_u32(&(proc->clogGroupNext), INVALID_PROC_NUMBER);
+		pg_atomic_init_u32(&(proc->commitTsGroupNext), INVALID_PROC_NUMBER);
 		pg_atomic_init_u64(&(proc->waitStart), 0);
 	}
 
@@ -532,6 +535,14 @@ InitProcess(void)
 	MyProc->clogGroupMemberLsn = InvalidXLogRecPtr;
 	Assert(pg_atomic_read_u32(&MyProc->clogGroupNext) == INVALID_PROC_NUMBER);
 
+	/* Initialize fields for group commit timestamp update. */
+	MyProc->commitTsGroupMember = false;
+	MyProc->commitTsGroupMemberXid = InvalidTransactionId;
+	MyProc->commitTsGroupMemberTime = 0;
+	MyProc->commitTsGroupMemberNodeId = InvalidReplOriginId;
+	MyProc->commitTsGroupMemberPage = -1;
+	Assert(pg_atomic_read_u32(&MyProc->commitTsGroupNext) == INVALID_PROC_NUMBER);
+
 	/*
 	 * Acquire ownership of the PGPROC's latch, so that we can use WaitLatch
 	 * on it.  That allows us to repoint the process latch, which so far
@@ -16,6 +16,14 @@
  * overhead isn't very significant compared to creating the relation in the
  * first place.
  *
+ * B-tree builds and sorted GiST builds write the whole index through this
+ * interface; other index AMs use it only to create the init fork of an
+ * unlogged index.  Hash, GIN and SP-GiST builds insert tuples through their
+ * regular insertion code, which places and splits pages in an order that is
+ * not sequential and relies on the buffer manager.  They would need a
+ * bottom-up build algorithm, as nbtsort.c has, before they could write
+ * through here.
+ *
  * The pages are WAL-logged if needed.  To save on WAL header overhead, we
  * WAL-log several pages in one record.
  *
@@ -46,8 +54,6 @@
 
 #define MAX_PENDING_WRITES XLR_MAX_BLOCK_ID
 
-static const PGIOAlignedBlock zero_buffer = {0};	/* worth BLCKSZ */
-
 typedef struct PendingWrite
 {
 	BulkWriteBuffer buf;
@@ -289,15 +295,16 @@ smgr_bulk_flush(BulkWriteState *bulkstate)
 			 * logically necessary on standard Unix filesystems (unwritten
 			 * space will read as zeroes anyway), but it should help to avoid
 			 * fragmentation.  The dummy pages aren't WAL-logged though.
+			 * Extend over the whole gap with one call, rather than writing
+			 * the zero pages one at a time.
 			 */
-			while (blkno > bulkstate->relsize)
+			if (blkno > bulkstate->relsize)
 			{
-				/* don't set checksum for all-zero page */
-				smgrextend(bulkstate->smgr, bulkstate->forknum,
-						   bulkstate->relsize,
-						   &zero_buffer,
-						   true);
-				bulkstate->relsize++;
+				smgrzeroextend(bulkstate->smgr, bulkstate->forknum,
+							   bulkstate->relsize,
+							   blkno - bulkstate->relsize,
+							   true);
+				bulkstate->relsize = blkno;
 			}
 
 			smgrextend(bulkstate->smgr, bulkstate->forknum, blkno, page, true);
@@ -1657,6 +1657,15 @@ exec_parse_message(const char *query_string,	/* string to execute */
  * exec_bind_message
  *
  * Process a "Bind" message to create a portal from a prepared statement
+ *
+ * Each Bind builds a fresh portal, and the following Execute sets up a new
+ * executor state and snapshot, even when the client is pipelining the same
+ * statement with a cached generic plan.  Keeping those alive between
+ * messages is less simple than it looks: the portal's resource owner and
+ * memory must be released on error, plan invalidation can arrive between
+ * any two messages, and in READ COMMITTED each statement is required to see
+ * a new snapshot.  The per-message cost is mostly in PortalStart and
+ * ExecutorStart, so that is where to look first.
  */
 static void
 exec_bind_message(StringInfo input_message)
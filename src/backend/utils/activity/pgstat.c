@@ -718,6 +718,12 @@ pgstat_initialize(void)
  *
  * Note that this is called only when not within a transaction, so it is fair
  * to use transaction stop time as an approximation of current time.
+ *
+ * Because non-forced flushes skip entries whose lock is busy and retry them
+ * on a later call, contention on a popular entry delays its counters rather
+ * than stalling the backend.  Entry locks are still needed even for simple
+ * counters, since a flush updates several fields of an entry together and
+ * readers expect to see them consistently.
  */
 long
 pgstat_report_stat(bool force)
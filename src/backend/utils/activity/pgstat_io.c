@@ -7,6 +7,15 @@
  * from pgstat.c to enforce the line between the statistics access / storage
  * implementation and the details about individual types of statistics.
  *
+ * IO statistics are deliberately kept per backend type, object and context
+ * rather than per relation: the pending counters are a small fixed-size
+ * array that can be updated without any lookup on every IO.  Per-relation
+ * IO timing would have to be accumulated into each relation's pending
+ * entry instead (as pgstat_relation.c does for block read and hit
+ * counts), and for IOs completed by a worker or by another backend
+ * through AIO, the completing process would have to find the issuer's
+ * entry, which it has no cheap way to do.
+ *
  * Copyright (c) 2021-2026, PostgreSQL Global Development Group
  *
  * IDENTIFICATION
@@ -18,6 +18,15 @@
  * the same reason pgstat_track_activities is not checked - the check adds
  * more work than it saves.
  *
+ * Because the current wait event lives in PGPROC->wait_event_info and is
+ * written with a plain store, any process with access to the proc array can
+ * sample it cheaply and without coordination, which is all that a sampling
+ * profiler needs; pg_stat_activity reads it the same way.  The value read by
+ * another process may be momentarily stale, which doesn't matter for
+ * sampling purposes.  Recording samples server-side (with the query ID from
+ * the backend status array) is left to extensions, which can do so from a
+ * background worker without any cooperation from the sampled backends.
+ *
  * ----------
  */
 #include "postgres.h"
@@ -121,16 +121,27 @@ date_in(PG_FUNCTION_ARGS)
 	int			ftype[MAXDATEFIELDS];
 	char		workbuf[MAXDATELEN + 1];
 	DateTimeErrorExtra extra;
+	bool		have_time;
+	bool		have_tz;
 
-	dterr = ParseDateTime(str, workbuf, sizeof(workbuf),
-						  field, ftype, MAXDATEFIELDS, &nf);
-	if (dterr == 0)
-		dterr = DecodeDateTime(field, ftype, nf,
-							   &dtype, tm, &fsec, &tzp, &extra);
-	if (dterr != 0)
+	/*
+	 * Try the common ISO 8601 form first.  As below, any time of day or zone
+	 * offset is ignored.
+	 */
+	if (DecodeISODateTimeFast(str, tm, &fsec, &have_time, &have_tz, &tzp))
+		dtype = DTK_DATE;
+	else
 	{
-		DateTimeParseError(dterr, &extra, str, "date", escontext);
-		PG_RETURN_NULL();
+		dterr = ParseDateTime(str, workbuf, sizeof(workbuf),
+							  field, ftype, MAXDATEFIELDS, &nf);
+		if (dterr == 0)
+			dterr = DecodeDateTime(field, ftype, nf,
+								   &dtype, tm, &fsec, &tzp, &extra);
+		if (dterr != 0)
+		{
+			DateTimeParseError(dterr, &extra, str, "date", escontext);
+			PG_RETURN_NULL();
+		}
 	}
 
 	switch (dtype)
@@ -968,6 +968,151 @@ ParseDateTime(const char *timestr, char *workbuf, size_t buflen,
 }
 
 
+/*
+ * DecodeISODateTimeFast()
+ * Interpret a date/time string in canonical ISO 8601 form without
+ * tokenizing it first.
+ *
+ * Bulk loads typically deliver timestamps in exactly the form that the
+ * default DateStyle produces, so it pays to recognize that form directly
+ * before falling back to ParseDateTime() and DecodeDateTime().  Accepted
+ * input is
+ *				"YYYY-MM-DD"
+ * optionally followed by a space or "T" and
+ *				"HH:MM:SS[.ffffff]"
+ * and then optionally by a numeric zone offset "+HH", "+HH:MM" or "+HHMM"
+ * (or with "-").  Nothing else, not even surrounding whitespace, is allowed.
+ *
+ * Returns true and fills *tm and *fsec if the string is of that form and all
+ * fields are in range.  *have_time is set if a time of day was given, and
+ * *have_tz and *tz if a zone offset was given (in seconds west of UTC, as
+ * for DecodeTimezone()).  Returns false for anything else, including input
+ * that is merely invalid; the caller must then use the general parser, which
+ * also takes care of reporting errors.
+ */
+bool
+DecodeISODateTimeFast(const char *str, struct pg_tm *tm, fsec_t *fsec,
+					  bool *have_time, bool *have_tz, int *tz)
+{
+	const char *cp = str;
+	int			year,
+				mon,
+				mday;
+	int			hour = 0,
+				min = 0,
+				sec = 0;
+	fsec_t		frac = 0;
+
+#define ISDIGIT2(p)	(isdigit((unsigned char) (p)[0]) && \
+					 isdigit((unsigned char) (p)[1]))
+#define DIGITS2(p)	(((p)[0] - '0') * 10 + ((p)[1] - '0'))
+
+	/* YYYY-MM-DD */
+	if (!ISDIGIT2(cp) || !ISDIGIT2(cp + 2) || cp[4] != '-' ||
+		!ISDIGIT2(cp + 5) || cp[7] != '-' || !ISDIGIT2(cp + 8))
+		return false;
+	year = DIGITS2(cp) * 100 + DIGITS2(cp + 2);
+	mon = DIGITS2(cp + 5);
+	mday = DIGITS2(cp + 8);
+	cp += 10;
+
+	if (year < 1 || mon < 1 || mon > MONTHS_PER_YEAR ||
+		mday < 1 || mday > day_tab[isleap(year)][mon - 1])
+		return false;
+
+	*have_time = false;
+	*have_tz = false;
+
+	/* [ T]HH:MM:SS[.ffffff] */
+	if (*cp == ' ' || *cp == 'T')
+	{
+		cp++;
+		if (!ISDIGIT2(cp) || cp[2] != ':' || !ISDIGIT2(cp + 3) ||
+			cp[5] != ':' || !ISDIGIT2(cp + 6))
+			return false;
+		hour = DIGITS2(cp);
+		min = DIGITS2(cp + 3);
+		sec = DIGITS2(cp + 6);
+		cp += 8;
+
+		/* leap seconds and 24:00:00 are left to DecodeTime() */
+		if (hour >= HOURS_PER_DAY || min >= MINS_PER_HOUR ||
+			sec >= SECS_PER_MINUTE)
+			return false;
+
+		if (*cp == '.')
+		{
+			int			ndigits = 0;
+
+			cp++;
+			while (isdigit((unsigned char) *cp))
+			{
+				if (++ndigits > 6)
+					return false;
+				frac = frac * 10 + (*cp++ - '0');
+			}
+			if (ndigits == 0)
+				return false;
+			while (ndigits++ < 6)
+				frac *= 10;
+		}
+		*have_time = true;
+	}
+
+	/*
+	 * [+-]HH[[:]MM], only after a time of day.  After a bare date,
+	 * ParseDateTime() would take "-HH" as part of the date, which
+	 * DecodeDate() then rejects.
+	 */
+	if (*have_time && (*cp == '+' || *cp == '-'))
+	{
+		int			sign = (*cp == '-') ? -1 : 1;
+		int			tzhour,
+					tzmin = 0;
+
+		cp++;
+		if (!ISDIGIT2(cp))
+			return false;
+		tzhour = DIGITS2(cp);
+		cp += 2;
+		if (*cp == ':')
+			cp++;
+		if (ISDIGIT2(cp))
+		{
+			tzmin = DIGITS2(cp);
+			cp += 2;
+		}
+		else if (cp[-1] == ':')
+			return false;
+
+		if (tzhour > MAX_TZDISP_HOUR || tzmin >= MINS_PER_HOUR)
+			return false;
+
+		*tz = -sign * (tzhour * MINS_PER_HOUR + tzmin) * SECS_PER_MINUTE;
+		*have_tz = true;
+	}
+
+#undef ISDIGIT2
+#undef DIGITS2
+
+	if (*cp != '\0')
+		return false;
+
+	tm->tm_year = year;
+	tm->tm_mon = mon;
+	tm->tm_mday = mday;
+	tm->tm_hour = hour;
+	tm->tm_min = min;
+	tm->tm_sec = sec;
+	tm->tm_isdst = -1;
+	tm->tm_gmtoff = 0;
+	tm->tm_zone = NULL;
+	*fsec = frac;
+
+	return true;
+}
+
+
 /*
  * DecodeDateTime()
  * Interpret previously parsed fields for general date and time.
@@ -0,0 +1,261 @@
+/*-------------------------------------------------------------------------
+ *
+ * hllfuncs.c
+ *	  Approximate aggregate functions based on HyperLogLog.
+ *
+ * approx_count_distinct() estimates the number of distinct non-null input
+ * values using the HyperLogLog estimator in lib/hyperloglog.c, so it needs
+ * only a fixed amount of memory per group instead of sorting or hashing
+ * every input value as count(DISTINCT ...) does.  Input values are hashed
+ * with the default hash function of their data type, which defines what
+ * counts as distinct; a type without one cannot be used.
+ *
+ * The transition state is a hyperLogLogState.  Partial states are combined
+ * by taking the register-wise maximum, so the aggregate supports partial and
+ * parallel aggregation.
+ *
+ * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/hllfuncs.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "common/hashfn.h"
+#include "fmgr.h"
+#include "lib/hyperloglog.h"
+#include "libpq/pqformat.h"
+#include "utils/builtins.h"
+#include "utils/fmgrprotos.h"
+#include "utils/typcache.h"
+#include "varatt.h"
+
+/*
+ * Bit width of the HyperLogLog estimators, i.e. log2 of the number of
+ * registers.  2^12 registers give a standard error of about 1.6%, at a cost
+ * of 4kB per group.
+ */
+#define APPROX_COUNT_DISTINCT_BWIDTH	12
+
+/*
+ * The hashes fed to the estimators are 32 bits wide, so at most 2^32 distinct
+ * values can be told apart.  Estimates are capped to that.
+ */
+#define APPROX_COUNT_DISTINCT_MAX		4294967296.0
+
+/*
+ * Create a new estimator in the aggregate memory context.
+ */
+static hyperLogLogState *
+makeApproxCountDistinctState(MemoryContext agg_context)
+{
+	MemoryContext old_context;
+	hyperLogLogState *state;
+
+	old_context = MemoryContextSwitchTo(agg_context);
+	state = palloc_object(hyperLogLogState);
+	initHyperLogLog(state, APPROX_COUNT_DISTINCT_BWIDTH);
+	MemoryContextSwitchTo(old_context);
+
+	return state;
+}
+
+/*
+ * approx_count_distinct_transfn
+ *		Aggregate transition function for approx_count_distinct(anyelement)
+ */
+Datum
+approx_count_distinct_transfn(PG_FUNCTION_ARGS)
+{
+	hyperLogLogState *state;
+	FmgrInfo   *hash_proc;
+	MemoryContext agg_context;
+	uint32		hash;
+
+	if (!AggCheckCallContext(fcinfo, &agg_context))
+		elog(ERROR, "aggregate function called in non-aggregate context");
+
+	state = PG_ARGISNULL(0) ? NULL : (hyperLogLogState *) PG_GETARG_POINTER(0);
+
+	if (state == NULL)
+		state = makeApproxCountDistinctState(agg_context);
+
+	/* Null input values are not counted */
+	if (PG_ARGISNULL(1))
+		PG_RETURN_POINTER(state);
+
+	/* Look up the hash function of the input type, once per call site */
+	hash_proc = (FmgrInfo *) fcinfo->flinfo->fn_extra;
+	if (hash_proc == NULL)
+	{
+		Oid			argtype = get_fn_expr_argtype(fcinfo->flinfo, 1);
+		TypeCacheEntry *typentry;
+
+		typentry = lookup_type_cache(argtype, TYPECACHE_HASH_PROC_FINFO);
+		if (!OidIsValid(typentry->hash_proc_finfo.fn_oid))
+			ereport(ERROR,
+					(errcode(ERRCODE_UNDEFINED_FUNCTION),
+					 errmsg("could not identify a hash function for type %s",
+							format_type_be(argtype))));
+
+		hash_proc = MemoryContextAlloc(fcinfo->flinfo->fn_mcxt,
+									   sizeof(FmgrInfo));
+		fmgr_info_copy(hash_proc, &typentry->hash_proc_finfo,
+					   fcinfo->flinfo->fn_mcxt);
+		fcinfo->flinfo->fn_extra = hash_proc;
+	}
+
+	hash = DatumGetUInt32(FunctionCall1Coll(hash_proc,
+											PG_GET_COLLATION(),
+											PG_GETARG_DATUM(1)));
+
+	/*
+	 * HyperLogLog depends on all bits of the hash being well distributed,
+	 * which not every type's hash function guarantees, so mix it once more.
+	 */
+	addHyperLogLog(state, murmurhash32(hash));
+
+	PG_RETURN_POINTER(state);
+}
+
+/*
+ * approx_count_distinct_combine
+ *		Aggregate combine function for approx_count_distinct(anyelement)
+ */
+Datum
+approx_count_distinct_combine(PG_FUNCTION_ARGS)
+{
+	hyperLogLogState *state1;
+	hyperLogLogState *state2;
+	MemoryContext agg_context;
+
+	if (!AggCheckCallContext(fcinfo, &agg_context))
+		elog(ERROR, "aggregate function called in non-aggregate context");
+
+	state1 = PG_ARGISNULL(0) ? NULL : (hyperLogLogState *) PG_GETARG_POINTER(0);
+	state2 = PG_ARGISNULL(1) ? NULL : (hyperLogLogState *) PG_GETARG_POINTER(1);
+
+	if (state2 == NULL)
+	{
+		if (state1 == NULL)
+			PG_RETURN_NULL();
+		PG_RETURN_POINTER(state1);
+	}
+
+	/* We must copy state2's data into the agg_context */
+	if (state1 == NULL)
+		state1 = makeApproxCountDistinctState(agg_context);
+
+	mergeHyperLogLog(state1, state2);
+
+	PG_RETURN_POINTER(state1);
+}
+
+/*
+ * approx_count_distinct_serialize
+ *		Aggregate serialize function for approx_count_distinct(anyelement)
+ *
+ * This is strict, so we need not handle NULL input
+ */
+Datum
+approx_count_distinct_serialize(PG_FUNCTION_ARGS)
+{
+	hyperLogLogState *state;
+	StringInfoData buf;
+	bytea	   *result;
+
+	/* cannot be called directly because of internal-type argument */
+	Assert(AggCheckCallContext(fcinfo, NULL));
+
+	state = (hyperLogLogState *) PG_GETARG_POINTER(0);
+
+	pq_begintypsend(&buf);
+
+	/* registerWidth */
+	pq_sendbyte(&buf, state->registerWidth);
+
+	/* registers */
+	pq_sendbytes(&buf, state->hashesArr, state->nRegisters);
+
+	result = pq_endtypsend(&buf);
+
+	PG_RETURN_BYTEA_P(result);
+}
+
+/*
+ * approx_count_distinct_deserialize
+ *		Aggregate deserial function for approx_count_distinct(anyelement)
+ *
+ * This is strict, so we need not handle NULL input
+ */
+Datum
+approx_count_distinct_deserialize(PG_FUNCTION_ARGS)
+{
+	bytea	   *sstate;
+	hyperLogLogState *result;
+	StringInfoData buf;
+	uint8		bwidth;
+
+	/* cannot be called directly because of internal-type argument */
+	Assert(AggCheckCallContext(fcinfo, NULL));
+
+	sstate = PG_GETARG_BYTEA_PP(0);
+
+	/*
+	 * Initialize a StringInfo so that we can "receive" it using the standard
+	 * recv-function infrastructure.
+	 */
+	initReadOnlyStringInfo(&buf, VARDATA_ANY(sstate),
+						   VARSIZE_ANY_EXHDR(sstate));
+
+	/* registerWidth */
+	bwidth = pq_getmsgbyte(&buf);
+
+	result = palloc_object(hyperLogLogState);
+	initHyperLogLog(result, bwidth);
+
+	/* registers */
+	memcpy(result->hashesArr,
+		   pq_getmsgbytes(&buf, result->nRegisters),
+		   result->nRegisters);
+
+	pq_getmsgend(&buf);
+
+	PG_RETURN_POINTER(result);
+}
+
+/*
+ * approx_count_distinct_finalfn
+ *		Aggregate final function for approx_count_distinct(anyelement)
+ */
+Datum
+approx_count_distinct_finalfn(PG_FUNCTION_ARGS)
+{
+	hyperLogLogState *state;
+	double		estimate;
+
+	/* cannot be called directly because of internal-type argument */
+	Assert(AggCheckCallContext(fcinfo, NULL));
+
+	state = PG_ARGISNULL(0) ? NULL : (hyperLogLogState *) PG_GETARG_POINTER(0);
+
+	/* Like count(), return zero rather than null for no input rows */
+	if (state == NULL)
+		PG_RETURN_INT64(0);
+
+	/*
+	 * Close to 2^32 distinct values, the estimator's large range correction
+	 * breaks down and can return infinity or NaN, so cap the result.
+	 */
+	estimate = estimateHyperLogLog(state);
+	if (!isfinite(estimate) || estimate > APPROX_COUNT_DISTINCT_MAX)
+		estimate = APPROX_COUNT_DISTINCT_MAX;
+
+	PG_RETURN_INT64((int64) rint(estimate));
+}
@@ -810,6 +810,24 @@ datum_to_jsonb_internal(Datum val, bool is_null, JsonbInState *result,
 						(void) JsonbIteratorNext(&it, &jb, true);
 						scalar_jsonb = true;
 					}
+					else if (result->parseState != NULL)
+					{
+						/*
+						 * When nesting the value in a larger result, as
+						 * jsonb_agg and friends do, keep it in serialized
+						 * form rather than expanding it into a JsonbValue
+						 * tree, which is far bigger and must be serialized
+						 * again at the end anyway.
+						 */
+						jb.type = jbvBinary;
+						jb.val.binary.data = &jsonb->root;
+						jb.val.binary.len = VARSIZE(jsonb) - VARHDRSZ;
+
+						if (result->parseState->contVal.type == jbvArray)
+							pushJsonbBinaryValue(result, WJB_ELEM, &jb);
+						else
+							pushJsonbBinaryValue(result, WJB_VALUE, &jb);
+					}
 					else
 					{
 						JsonbIteratorToken type;
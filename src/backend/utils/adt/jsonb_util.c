@@ -48,6 +48,7 @@ static Jsonb *convertToJsonb(JsonbValue *val);
 static void convertJsonbValue(StringInfo buffer, JEntry *header, JsonbValue *val, int level);
 static void convertJsonbArray(StringInfo buffer, JEntry *header, JsonbValue *val, int level);
 static void convertJsonbObject(StringInfo buffer, JEntry *header, JsonbValue *val, int level);
+static void convertJsonbBinary(StringInfo buffer, JEntry *header, JsonbValue *val);
 static void convertJsonbScalar(StringInfo buffer, JEntry *header, JsonbValue *scalarVal);
 
 static int	reserveFromBuffer(StringInfo buffer, int len);
@@ -430,11 +431,20 @@ getKeyJsonValueFromContainer(JsonbContainer *container,
 
 		stopMiddle = stopLow + (stopHigh - stopLow) / 2;
 
-		candidateVal = baseAddr + getJsonbOffset(container, stopMiddle);
+		/*
+		 * Keys are sorted by length first, and the length of most keys is
+		 * stored directly in the JEntry, whereas finding a key's offset may
+		 * mean summing the lengths of up to JB_OFFSET_STRIDE preceding
+		 * entries.  So look at the offset only once the lengths match.
+		 */
 		candidateLen = getJsonbLength(container, stopMiddle);
-
-		difference = lengthCompareJsonbString(candidateVal, candidateLen,
-											  keyVal, keyLen);
+		if (candidateLen != keyLen)
+			difference = candidateLen > keyLen ? 1 : -1;
+		else
+		{
+			candidateVal = baseAddr + getJsonbOffset(container, stopMiddle);
+			difference = memcmp(candidateVal, keyVal, keyLen);
+		}
 
 		if (difference == 0)
 		{
@@ -655,6 +665,49 @@ pushJsonbValue(JsonbInState *pstate, JsonbIteratorToken seq,
 							  v.val.array.rawScalar) ? &v : NULL);
 }
 
+/*
+ * Push a jbvBinary array or object into JsonbInState as a WJB_ELEM or
+ * WJB_VALUE without unpacking it, unlike pushJsonbValue().
+ *
+ * The container is kept in serialized form in the JsonbValue tree, and
+ * convertToJsonb() copies it verbatim into the final Jsonb.  That is much
+ * cheaper than building a tree node for each of its members, which matters
+ * when aggregating many jsonb values.  As with scalars, the container is
+ * copied into the outcontext if one is specified.  The container must not
+ * be a raw scalar, since that has to be stored as a plain scalar instead.
+ */
+void
+pushJsonbBinaryValue(JsonbInState *pstate, JsonbIteratorToken seq,
+					 JsonbValue *jbval)
+{
+	JsonbValue	v = *jbval;
+
+	Assert(v.type == jbvBinary);
+	Assert(!JsonContainerIsScalar(v.val.binary.data));
+	Assert(pstate->parseState != NULL);
+
+	if (pstate->outcontext != NULL)
+	{
+		JsonbContainer *copy = MemoryContextAlloc(pstate->outcontext,
+												  v.val.binary.len);
+
+		memcpy(copy, v.val.binary.data, v.val.binary.len);
+		v.val.binary.data = copy;
+	}
+
+	switch (seq)
+	{
+		case WJB_VALUE:
+			appendValue(pstate, &v, false);
+			break;
+		case WJB_ELEM:
+			appendElement(pstate, &v, false);
+			break;
+		default:
+			elog(ERROR, "unexpected jsonb sequential processing token");
+	}
+}
+
 /*
  * Do the actual pushing, with only scalar or pseudo-scalar-array values
  * accepted.
@@ -1670,6 +1723,13 @@ padBufferToInt(StringInfo buffer)
 
 /*
  * Given a JsonbValue, convert to Jsonb. The result is palloc'd.
+ *
+ * Input is always materialized as a complete JsonbValue tree first, because
+ * object keys must be sorted and de-duplicated (see uniqueifyJsonbObject)
+ * before the container can be laid out, and because each container's JEntry
+ * array, which precedes its children, can't be sized until all of them are
+ * known.  Encoding straight from parse events would have to buffer each
+ * open container's children anyway.
  */
 static Jsonb *
 convertToJsonb(JsonbValue *val)
@@ -1722,10 +1782,10 @@ convertJsonbValue(StringInfo buffer, JEntry *header, JsonbValue *val, int level)
 		return;
 
 	/*
-	 * A JsonbValue passed as val should never have a type of jbvBinary, and
-	 * neither should any of its sub-components. Those values will be produced
-	 * by convertJsonbArray and convertJsonbObject, the results of which will
-	 * not be passed back to this function as an argument.
+	 * The top-level JsonbValue passed to convertToJsonb is never jbvBinary,
+	 * but its sub-components can be, if they were added with
+	 * pushJsonbBinaryValue.  Those are already in the on-disk format, so we
+	 * just copy them.
 	 */
 
 	if (IsAJsonbScalar(val))
@@ -1734,10 +1794,36 @@ convertJsonbValue(StringInfo buffer, JEntry *header, JsonbValue *val, int level)
 		convertJsonbArray(buffer, header, val, level);
 	else if (val->type == jbvObject)
 		convertJsonbObject(buffer, header, val, level);
+	else if (val->type == jbvBinary)
+		convertJsonbBinary(buffer, header, val);
 	else
 		elog(ERROR, "unknown type of jsonb container to convert");
 }
 
+/*
+ * Copy an already-serialized array or object into buffer.  Offsets within a
+ * container are relative to its own start, so it remains valid as long as
+ * it stays int-aligned.
+ */
+static void
+convertJsonbBinary(StringInfo buffer, JEntry *header, JsonbValue *val)
+{
+	int			base_offset = buffer->len;
+
+	Assert(!JsonContainerIsScalar(val->val.binary.data));
+
+	padBufferToInt(buffer);
+	appendToBuffer(buffer, val->val.binary.data, val->val.binary.len);
+
+	if (buffer->len - base_offset > JENTRY_OFFLENMASK)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("total size of jsonb array elements exceeds the maximum of %d bytes",
+						JENTRY_OFFLENMASK)));
+
+	*header = JENTRY_ISCONTAINER | (buffer->len - base_offset);
+}
+
 static void
 convertJsonbArray(StringInfo buffer, JEntry *header, JsonbValue *val, int level)
 {
@@ -49,6 +49,15 @@
  * we calculate operands first.  Then we check that results are numeric
  * singleton lists, calculate the result and pass it to the next path item.
  *
+ * The jsonpath datum itself is already a flat, position-independent encoding
+ * of the item tree (see jsonpath.h), and JsonPathItems are decoded from it
+ * on the fly by jspInit() and friends without copying, so there is no
+ * separate parse step to cache across rows.  What does recur per row is the
+ * allocation of result lists and of JsonbValues extracted from the document;
+ * avoiding those for simple accessor-and-filter paths would need a separate
+ * evaluator, since the general one must be able to materialize any item's
+ * result sequence.
+ *
  * Copyright (c) 2019-2026, PostgreSQL Global Development Group
  *
  * IDENTIFICATION
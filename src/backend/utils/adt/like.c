@@ -115,6 +115,7 @@ wchareq(const char *p1, int p1len, const char *p2, int p2len)
 
 #define MatchText	SB_MatchText
 #define do_like_escape	SB_do_like_escape
+#define MATCH_MEMCHR
 
 #include "like_match.c"
 
@@ -130,6 +131,8 @@ wchareq(const char *p1, int p1len, const char *p2, int p2len)
 #define NextChar(p, plen) \
 	do { (p)++; (plen)--; } while ((plen) > 0 && (*(p) & 0xC0) == 0x80 )
 #define MatchText	UTF8_MatchText
+/* UTF8 lead bytes and ASCII bytes never appear inside another character */
+#define MATCH_MEMCHR
 
 #include "like_match.c"
 
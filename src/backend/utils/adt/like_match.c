@@ -15,6 +15,9 @@
  * MatchText - to name of function wanted
  * do_like_escape - name of function if wanted - needs CHAREQ and CopyAdvChar
  * MATCH_LOWER - define for case (4) to specify case folding for 1-byte chars
+ * MATCH_MEMCHR - define if a text byte equal to the first byte of a pattern
+ *		character can only occur at a character boundary, so that memchr()
+ *		can be used to find candidate match positions
  *
  * Copyright (c) 1996-2026, PostgreSQL Global Development Group
  *
@@ -173,6 +176,18 @@ MatchText(const char *t, int tlen, const char *p, int plen, pg_locale_t locale)
 
 			while (tlen > 0)
 			{
+#ifdef MATCH_MEMCHR
+				/* Jump straight to the next possible match position */
+				if (!nondeterministic)
+				{
+					const char *next = memchr(t, (unsigned char) firstpat, tlen);
+
+					if (next == NULL)
+						break;
+					tlen -= next - t;
+					t = next;
+				}
+#endif
 				if (GETCHAR(*t) == firstpat || nondeterministic)
 				{
 					int			matched = MatchText(t, tlen, p, plen, locale);
@@ -514,6 +529,10 @@ do_like_escape(text *pat, text *esc)
 
 #undef GETCHAR
 
+#ifdef MATCH_MEMCHR
+#undef MATCH_MEMCHR
+#endif
+
 #ifdef MATCH_LOWER
 #undef MATCH_LOWER
 
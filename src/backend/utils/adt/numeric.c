@@ -376,6 +376,16 @@ typedef struct
  * To initialize a new accumulator, simply reset all fields to zeros.
  *
  * The accumulator does not handle NaNs.
+ *
+ * Summing into a 128-bit scaled integer instead would be faster still when
+ * all inputs have small weight and a common dscale (say, numeric(18,2)),
+ * but inputs need not share a scale, so such a fast path would have to
+ * rescale values and switch over to this representation on the first input
+ * that doesn't fit, and the partial-aggregate serialization format would
+ * have to carry both forms.  Adding a value here is already just a loop of
+ * int32 additions over the input's digits, so the gain is smaller than it
+ * might appear; most of the per-row cost is in detoasting and unpacking the
+ * input.
  * ----------
  */
 typedef struct NumericSumAccum
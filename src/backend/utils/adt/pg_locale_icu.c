@@ -686,6 +686,11 @@ downcase_ident_icu(char *dst, size_t dstsize, const char *src,
  *
  * Call ucol_strcollUTF8() or ucol_strcoll() as appropriate for the given
  * database encoding.
+ *
+ * We don't try to short-circuit pure-ASCII inputs here: ICU orderings of
+ * ASCII are not bytewise even for the root locale, and ICU already has its
+ * own fast path for Latin text inside ucol_strcollUTF8().  The bigger cost
+ * in sorting is the number of calls, which abbreviated keys reduce.
  */
 int
 strncoll_icu_utf8(const char *arg1, size_t len1, const char *arg2, size_t len2,
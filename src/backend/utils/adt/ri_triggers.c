@@ -3108,6 +3108,7 @@ ri_FastPathFlushArray(RI_FastPathEntry *fpentry, TupleTableSlot *fk_slot,
 	bool		elem_byval;
 	char		elem_align;
 	ArrayType  *arr;
+	bool		datum_eq;
 
 	Assert(fpmeta);
 
@@ -3170,6 +3171,15 @@ ri_FastPathFlushArray(RI_FastPathEntry *fpentry, TupleTableSlot *fk_slot,
 
 	index_rescan(scandesc, skey, 1, NULL, 0);
 
+	/*
+	 * For the common integer key types, equality is the same as Datum
+	 * equality, so the matching loop below can skip the function call.
+	 */
+	datum_eq = (eq_opr_finfo->fn_oid == F_INT2EQ ||
+				eq_opr_finfo->fn_oid == F_INT4EQ ||
+				eq_opr_finfo->fn_oid == F_INT8EQ ||
+				eq_opr_finfo->fn_oid == F_OIDEQ);
+
 	/*
 	 * Walk all matches.  The index AM returns them in index order.  For each
 	 * match, find which batch item(s) it satisfies.
@@ -3211,7 +3221,9 @@ ri_FastPathFlushArray(RI_FastPathEntry *fpentry, TupleTableSlot *fk_slot,
 		 */
 		for (int i = 0; i < nvals; i++)
 		{
-			if (!matched[i] &&
+			if (matched[i])
+				continue;
+			if (datum_eq ? found_val == search_vals[i] :
 				DatumGetBool(FunctionCall2Coll(eq_opr_finfo,
 											   idx_rel->rd_indcollation[0],
 											   found_val,
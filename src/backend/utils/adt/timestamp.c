@@ -175,6 +175,19 @@ timestamp_in(PG_FUNCTION_ARGS)
 	int			ftype[MAXDATEFIELDS];
 	char		workbuf[MAXDATELEN + MAXDATEFIELDS];
 	DateTimeErrorExtra extra;
+	bool		have_time;
+	bool		have_tz;
+
+	/* Try the common ISO 8601 form first; any zone offset is ignored */
+	if (DecodeISODateTimeFast(str, tm, &fsec, &have_time, &have_tz, &tz))
+	{
+		if (tm2timestamp(tm, fsec, NULL, &result) != 0)
+			ereturn(escontext, (Datum) 0,
+					(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
+					 errmsg("timestamp out of range: \"%s\"", str)));
+		AdjustTimestampForTypmod(&result, typmod, escontext);
+		PG_RETURN_TIMESTAMP(result);
+	}
 
 	dterr = ParseDateTime(str, workbuf, sizeof(workbuf),
 						  field, ftype, MAXDATEFIELDS, &nf);
@@ -431,6 +444,21 @@ timestamptz_in(PG_FUNCTION_ARGS)
 	int			ftype[MAXDATEFIELDS];
 	char		workbuf[MAXDATELEN + MAXDATEFIELDS];
 	DateTimeErrorExtra extra;
+	bool		have_time;
+	bool		have_tz;
+
+	/* Try the common ISO 8601 form first */
+	if (DecodeISODateTimeFast(str, tm, &fsec, &have_time, &have_tz, &tz))
+	{
+		if (!have_tz)
+			tz = DetermineTimeZoneOffset(tm, session_timezone);
+		if (tm2timestamp(tm, fsec, &tz, &result) != 0)
+			ereturn(escontext, (Datum) 0,
+					(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
+					 errmsg("timestamp out of range: \"%s\"", str)));
+		AdjustTimestampForTypmod(&result, typmod, escontext);
+		PG_RETURN_TIMESTAMPTZ(result);
+	}
 
 	dterr = ParseDateTime(str, workbuf, sizeof(workbuf),
 						  field, ftype, MAXDATEFIELDS, &nf);
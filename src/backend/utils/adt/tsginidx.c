@@ -3,6 +3,12 @@
  * tsginidx.c
  *	 GIN support functions for tsvector_ops
  *
+ * Only lexemes are indexed, not their positions or frequencies, so the
+ * index can tell which rows match but not how well; ranking always needs
+ * the heap tuple's tsvector.  Ranked retrieval from the index would need
+ * GIN posting lists that carry a per-item payload, and an index AM
+ * interface for returning rows in score order, neither of which exists.
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  *
  *
@@ -1433,6 +1433,11 @@ checkcondition_str(void *checkval, QueryOperand *val, ExecPhraseData *data)
  *
  * Returns TS_YES if any positions were emitted to *data; or if data is NULL,
  * returns TS_YES if any positions would have been emitted.
+ *
+ * This is a single linear merge.  Position lists hold at most MAXNUMPOS
+ * entries per lexeme, so there is little to gain from vectorizing it; the
+ * cost of phrase matching is dominated by finding the lexemes in each
+ * tsvector and by the recursion over the query tree.
  */
 #define TSPO_L_ONLY		0x01	/* emit positions appearing only in L */
 #define TSPO_R_ONLY		0x02	/* emit positions appearing only in R */
@@ -648,9 +648,11 @@ CatCacheInvalidate(CatCache *cache, uint32 hashValue)
 	CACHE_elog(DEBUG2, "CatCacheInvalidate: called");
 
 	/*
-	 * We don't bother to check whether the cache has finished initialization
-	 * yet; if not, there will be no entries in it so no problem.
+	 * If the cache hasn't finished initialization yet, there are no entries
+	 * in it, and its hash buckets haven't even been allocated.
 	 */
+	if (cache->cc_bucket == NULL)
+		return;
 
 	/*
 	 * Invalidate *all* CatCLists in this cache; it's too hard to tell which
@@ -773,7 +775,7 @@ ResetCatalogCache(CatCache *cache, bool debug_discard)
 	}
 
 	/* Remove each tuple in this cache, or at least mark it dead */
-	for (i = 0; i < cache->cc_nbuckets; i++)
+	for (i = 0; cache->cc_bucket != NULL && i < cache->cc_nbuckets; i++)
 	{
 		dlist_head *bucket = &cache->cc_bucket[i];
 
@@ -947,12 +949,14 @@ InitCatCache(int id,
 	 */
 	cp = (CatCache *) palloc_aligned(sizeof(CatCache), PG_CACHE_LINE_SIZE,
 									 MCXT_ALLOC_ZERO);
-	cp->cc_bucket = palloc0(nbuckets * sizeof(dlist_head));
 
 	/*
-	 * Many catcaches never receive any list searches.  Therefore, we don't
-	 * allocate the cc_lbuckets till we get a list search.
+	 * Most backends only ever search a fraction of the catcaches, so the hash
+	 * buckets aren't allocated until CatalogCacheInitializeCache().
+	 * Likewise, many catcaches never receive any list searches.  Therefore,
+	 * we don't allocate the cc_lbuckets till we get a list search.
 	 */
+	cp->cc_bucket = NULL;
 	cp->cc_lbucket = NULL;
 
 	/*
@@ -1175,6 +1179,10 @@ CatalogCacheInitializeCache(CatCache *cache)
 	cache->cc_relname = pstrdup(RelationGetRelationName(relation));
 	cache->cc_relisshared = RelationGetForm(relation)->relisshared;
 
+	/* now that the cache is going to be used, allocate its hash buckets */
+	if (cache->cc_bucket == NULL)
+		cache->cc_bucket = palloc0(cache->cc_nbuckets * sizeof(dlist_head));
+
 	/*
 	 * return to the caller's memory context and close the rel
 	 */
@@ -43,6 +43,14 @@
  * bare-bones; it's the caller's responsibility to build a new expression
  * if the old one gets invalidated.
  *
+ * All of this state is private to the backend.  Sharing generic plans among
+ * sessions would be possible in principle, since a PlannedStmt can be
+ * flattened with nodeToString(), but a shared entry would need to be keyed
+ * on everything that can affect parse analysis (query text, search_path,
+ * role, RLS environment, relevant GUCs), and the invalidation rules above
+ * would have to be applied to it by every backend that receives an sinval
+ * event.  Nothing like that exists today.
+ *
  *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -1906,6 +1914,18 @@ QueryListGetPrimaryStmt(List *stmts)
 /*
  * AcquireExecutorLocks: acquire locks needed for execution of a cached plan;
  * or release them if acquire is false.
+ *
+ * Note that we lock every relation in the range table, including partitions
+ * that ExecDoInitialPruning() will go on to discard.  Pruned result
+ * relations of an UPDATE, DELETE or MERGE are never opened (ModifyTable only
+ * builds ResultRelInfos for members of es_unpruned_relids), and INSERT and
+ * ON CONFLICT route tuples into partitions whose ResultRelInfos are built on
+ * first use by ExecFindPartition(), so the remaining per-partition cost for a
+ * generic plan is mostly the lock itself.  Deferring these locks until after
+ * initial pruning would require that pruning be done against a plan that is
+ * not yet known to be valid, and that the plan be re-checked (and possibly
+ * replanned) after the surviving partitions are locked; that is a much more
+ * invasive change to the plan cache and executor start-up protocol.
  */
 static void
 AcquireExecutorLocks(List *stmt_list, bool acquire)
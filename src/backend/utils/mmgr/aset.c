@@ -46,6 +46,10 @@
 
 #include "postgres.h"
 
+#ifndef WIN32
+#include <sys/mman.h>
+#endif
+
 #include "port/pg_bitutils.h"
 #include "utils/memdebug.h"
 #include "utils/memutils.h"
@@ -264,6 +268,39 @@ static AllocSetFreeList context_freelists[2] =
 	}
 };
 
+/*
+ * Similarly, rather than returning every non-keeper block to malloc() when a
+ * context is reset or deleted, we keep a limited number of freed blocks in a
+ * backend-local cache and hand them out again when any context needs a new
+ * block of the same size.  This saves repeated malloc()/free() traffic (and,
+ * for larger blocks, mmap()/munmap() calls) for queries that repeatedly fill
+ * and reset per-tuple or per-group contexts.
+ *
+ * Only blocks whose size is a power of 2 between ALLOC_BLOCK_CACHE_MINBITS
+ * and ALLOC_BLOCK_CACHE_MAXBITS are cached, which covers the normal block
+ * size progression of contexts created with the standard size parameters;
+ * dedicated blocks for oversize chunks are just however big they need to be
+ * and are seldom eligible.  The total amount of memory held in the cache is
+ * bounded by ALLOC_BLOCK_CACHE_LIMIT, and the cache is emptied before giving
+ * up if malloc() fails.  Memory held in the cache is not counted in any
+ * context's mem_allocated.
+ *
+ * Cached blocks of each size are chained through their first word.
+ */
+#define ALLOC_BLOCK_CACHE_MINBITS	13	/* 8kB */
+#define ALLOC_BLOCK_CACHE_MAXBITS	20	/* 1MB */
+#define ALLOC_BLOCK_CACHE_NCLASSES \
+	(ALLOC_BLOCK_CACHE_MAXBITS - ALLOC_BLOCK_CACHE_MINBITS + 1)
+#define ALLOC_BLOCK_CACHE_LIMIT		(4 * 1024 * 1024)	/* arbitrary */
+
+typedef struct AllocBlockCacheLink
+{
+	struct AllocBlockCacheLink *next;
+} AllocBlockCacheLink;
+
+static AllocBlockCacheLink *block_cache[ALLOC_BLOCK_CACHE_NCLASSES];
+static Size block_cache_size = 0;	/* total bytes held in block_cache */
+
 
 /* ----------
  * AllocSetFreeIndex -
@@ -530,6 +567,125 @@ AllocSetContextCreateInternal(MemoryContext parent,
 	return (MemoryContext) set;
 }
 
+/*
+ * Dedicated blocks for very large chunks, such as hash join bucket arrays and
+ * tuplesort's memtuples array, are typically written in their entirety soon
+ * after being allocated.  Faulting them in one base page at a time, and then
+ * missing in the TLB on every access, is a measurable cost, so we ask the
+ * kernel to back blocks of at least ALLOC_HUGEPAGE_THRESHOLD bytes with
+ * transparent huge pages where that's supported.  This is only advice; it
+ * has no effect if transparent huge pages are disabled system-wide.
+ */
+#define ALLOC_HUGEPAGE_THRESHOLD	(32 * 1024 * 1024)
+#define ALLOC_HUGEPAGE_SIZE			(2 * 1024 * 1024)
+
+static inline void
+AllocBlockAdviseHugePages(void *block, Size blksize)
+{
+#ifdef MADV_HUGEPAGE
+	if (blksize >= ALLOC_HUGEPAGE_THRESHOLD)
+	{
+		uintptr_t	start = TYPEALIGN(ALLOC_HUGEPAGE_SIZE, (uintptr_t) block);
+		uintptr_t	end = TYPEALIGN_DOWN(ALLOC_HUGEPAGE_SIZE,
+										 (uintptr_t) block + blksize);
+
+		if (end > start)
+			(void) madvise((void *) start, end - start, MADV_HUGEPAGE);
+	}
+#endif
+}
+
+/*
+ * AllocBlockCacheIndex
+ *		Return the block_cache[] index for a block of size blksize, or -1
+ *		if blocks of that size aren't cached.
+ */
+static inline int
+AllocBlockCacheIndex(Size blksize)
+{
+	int			bits;
+
+	if (blksize < ((Size) 1 << ALLOC_BLOCK_CACHE_MINBITS) ||
+		blksize > ((Size) 1 << ALLOC_BLOCK_CACHE_MAXBITS) ||
+		(blksize & (blksize - 1)) != 0)
+		return -1;
+
+	bits = pg_leftmost_one_pos64((uint64) blksize);
+	return bits - ALLOC_BLOCK_CACHE_MINBITS;
+}
+
+/*
+ * AllocBlockMalloc
+ *		Obtain memory for a new block of size blksize, preferring a cached
+ *		block of that size over calling malloc().
+ *
+ * Returns NULL if no memory is available.
+ */
+static void *
+AllocBlockMalloc(Size blksize)
+{
+	int			idx = AllocBlockCacheIndex(blksize);
+	void	   *block;
+
+	if (idx >= 0 && block_cache[idx] != NULL)
+	{
+		AllocBlockCacheLink *link = block_cache[idx];
+
+		VALGRIND_MAKE_MEM_DEFINED(link, sizeof(AllocBlockCacheLink));
+		block_cache[idx] = link->next;
+		block_cache_size -= blksize;
+		VALGRIND_MAKE_MEM_UNDEFINED(link, blksize);
+		return link;
+	}
+
+	block = malloc(blksize);
+
+	/* If malloc fails, release the cache and try once more */
+	if (block == NULL && block_cache_size > 0)
+	{
+		for (int i = 0; i < ALLOC_BLOCK_CACHE_NCLASSES; i++)
+		{
+			while (block_cache[i] != NULL)
+			{
+				AllocBlockCacheLink *link = block_cache[i];
+
+				VALGRIND_MAKE_MEM_DEFINED(link, sizeof(AllocBlockCacheLink));
+				block_cache[i] = link->next;
+				free(link);
+			}
+		}
+		block_cache_size = 0;
+		block = malloc(blksize);
+	}
+
+	return block;
+}
+
+/*
+ * AllocBlockFree
+ *		Release a block of size blksize obtained from AllocBlockMalloc(),
+ *		keeping it in the block cache if there's room.
+ */
+static void
+AllocBlockFree(void *block, Size blksize)
+{
+	int			idx = AllocBlockCacheIndex(blksize);
+
+	if (idx >= 0 && block_cache_size + blksize <= ALLOC_BLOCK_CACHE_LIMIT)
+	{
+		AllocBlockCacheLink *link = (AllocBlockCacheLink *) block;
+
+		VALGRIND_MAKE_MEM_UNDEFINED(link, sizeof(AllocBlockCacheLink));
+		link->next = block_cache[idx];
+		block_cache[idx] = link;
+		block_cache_size += blksize;
+		VALGRIND_MAKE_MEM_NOACCESS(link, blksize);
+		return;
+	}
+
+	free(block);
+}
+
 /*
  * AllocSetReset
  *		Frees all memory which is allocated in the given set.
@@ -588,8 +744,10 @@ AllocSetReset(MemoryContext context)
 		}
 		else
 		{
+			Size		blksize = block->endptr - ((char *) block);
+
 			/* Normal case, release the block */
-			context->mem_allocated -= block->endptr - ((char *) block);
+			context->mem_allocated -= blksize;
 
 #ifdef CLOBBER_FREED_MEMORY
 			wipe_mem(block, block->freeptr - ((char *) block));
@@ -602,7 +760,7 @@ AllocSetReset(MemoryContext context)
 			 */
 			VALGRIND_MEMPOOL_FREE(set, block);
 
-			free(block);
+			AllocBlockFree(block, blksize);
 		}
 		block = next;
 	}
@@ -694,9 +852,10 @@ AllocSetDelete(MemoryContext context)
 	while (block != NULL)
 	{
 		AllocBlock	next = block->next;
+		Size		blksize = block->endptr - ((char *) block);
 
 		if (!IsKeeperBlock(set, block))
-			context->mem_allocated -= block->endptr - ((char *) block);
+			context->mem_allocated -= blksize;
 
 #ifdef CLOBBER_FREED_MEMORY
 		wipe_mem(block, block->freeptr - ((char *) block));
@@ -706,7 +865,7 @@ AllocSetDelete(MemoryContext context)
 		{
 			/* As in AllocSetReset, free block-header vchunks explicitly */
 			VALGRIND_MEMPOOL_FREE(set, block);
-			free(block);
+			AllocBlockFree(block, blksize);
 		}
 
 		block = next;
@@ -755,6 +914,8 @@ AllocSetAllocLarge(MemoryContext context, Size size, int flags)
 	if (block == NULL)
 		return MemoryContextAllocationFailure(context, size, flags);
 
+	AllocBlockAdviseHugePages(block, blksize);
+
 	/* Make a vchunk covering the new block's header */
 	VALGRIND_MEMPOOL_ALLOC(set, block, ALLOC_BLOCKHDRSZ);
 
@@ -947,7 +1108,7 @@ AllocSetAllocFromNewBlock(MemoryContext context, Size size, int flags,
 		blksize <<= 1;
 
 	/* Try to allocate it */
-	block = (AllocBlock) malloc(blksize);
+	block = (AllocBlock) AllocBlockMalloc(blksize);
 
 	/*
 	 * We could be asking for pretty big blocks here, so cope if malloc fails.
@@ -958,7 +1119,7 @@ AllocSetAllocFromNewBlock(MemoryContext context, Size size, int flags,
 		blksize >>= 1;
 		if (blksize < required_size)
 			break;
-		block = (AllocBlock) malloc(blksize);
+		block = (AllocBlock) AllocBlockMalloc(blksize);
 	}
 
 	if (block == NULL)
@@ -1307,6 +1468,9 @@ AllocSetRealloc(void *pointer, Size size, int flags)
 		VALGRIND_MEMPOOL_CHANGE(set, block, newblock, ALLOC_BLOCKHDRSZ);
 		block = newblock;
 
+		if (blksize > oldblksize)
+			AllocBlockAdviseHugePages(block, blksize);
+
 		/* updated separately, not to underflow when (oldblksize > blksize) */
 		set->header.mem_allocated -= oldblksize;
 		set->header.mem_allocated += blksize;
@@ -28,7 +28,11 @@
  * allocation of small objects from pre-existing superblocks uses one LWLock
  * per pool.  Currently there is one pool, and therefore one lock, per size
  * class.  Per-core pools to increase concurrency and strategies for reducing
- * the resulting fragmentation are areas for future research.  Each superblock
+ * the resulting fragmentation are areas for future research.  Meanwhile,
+ * callers that allocate many small objects concurrently should carve them out
+ * of larger per-backend allocations themselves, as Parallel Hash does with
+ * its 32KB chunks (see ExecParallelHashTupleAlloc), so that only one in many
+ * allocations reaches the locks here.  Each superblock
  * is managed with a 'span', which tracks the superblock's freelist.  Free
  * requests are handled by looking in the page map to find which span an
  * address was allocated from, so that small objects can be returned to the
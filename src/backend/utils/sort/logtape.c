@@ -66,6 +66,14 @@
  * There will always be the same number of runs as input tapes, and the same
  * number of input tapes as participants (worker Tuplesortstates).
  *
+ * Blocks are written uncompressed.  Compressing them (with LZ4, say) would
+ * cut temp-file I/O for wide tuples, but it fits poorly with the scheme
+ * above: recycling and the prev/next chain both depend on every block
+ * occupying exactly one BLCKSZ slot in the underlying file, and a block
+ * that compressed to fewer bytes would still consume a whole slot.  Saving
+ * I/O would require packing variable-sized compressed blocks and tracking
+ * their offsets, which in turn makes space recycling much harder.
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -330,6 +338,16 @@ ltsReadFillBuffer(LogicalTape *lt)
 		/* Advance to next block, if we have buffer space left */
 	} while (lt->buffer_size - lt->nbytes > BLCKSZ);
 
+	/*
+	 * During a merge, the next block of this tape is usually not adjacent to
+	 * the ones we just read, so the kernel's sequential readahead won't have
+	 * fetched it.  Start reading it now, so that it's hopefully in the page
+	 * cache by the time this tape's buffer has been consumed.
+	 */
+	if (lt->nextBlockNumber != -1L)
+		BufFilePrefetchBlock(lt->tapeSet->pfile,
+							 lt->nextBlockNumber + lt->offsetBlockNumber);
+
 	return (lt->nbytes > 0);
 }
 
@@ -690,6 +690,25 @@ write_reconstructed_file(const char *input_filename,
 			/* copy_file_range modifies the offset, so use a local copy */
 			off_t		off = offsetmap[i];
 			size_t		nwritten = 0;
+			unsigned	nblocks = 1;
+			size_t		nbytes;
+
+			/*
+			 * Copy as many following blocks as are stored contiguously in
+			 * the same source file with a single call, so that the kernel
+			 * can share or copy whole extents rather than one block at a
+			 * time.
+			 */
+			while (i + nblocks < block_length &&
+				   sourcemap[i + nblocks] == s &&
+				   offsetmap[i + nblocks] == offsetmap[i] + (off_t) nblocks * BLCKSZ)
+			{
+				s->num_blocks_read++;
+				nblocks++;
+			}
+			s->highest_offset_read = Max(s->highest_offset_read,
+										 offsetmap[i] + (off_t) nblocks * BLCKSZ);
+			nbytes = (size_t) nblocks * BLCKSZ;
 
 			/*
 			 * Retry until we've written all the bytes (the offset is updated
@@ -699,7 +718,7 @@ write_reconstructed_file(const char *input_filename,
 			{
 				ssize_t		wb;
 
-				wb = copy_file_range(s->fd, &off, wfd, NULL, BLCKSZ - nwritten, 0);
+				wb = copy_file_range(s->fd, &off, wfd, NULL, nbytes - nwritten, 0);
 
 				if (wb < 0)
 					pg_fatal("error while copying file range from \"%s\" to \"%s\": %m",
@@ -710,20 +729,26 @@ write_reconstructed_file(const char *input_filename,
 
 				nwritten += wb;
 
-			} while (BLCKSZ > nwritten);
+			} while (nbytes > nwritten);
 
 			/*
-			 * When checksum calculation not needed, we're done, otherwise
-			 * read the block and pass it to the checksum calculation.
+			 * When checksum calculation is needed, read the blocks back and
+			 * pass them to the checksum calculation.
 			 */
-			if (checksum_ctx->type == CHECKSUM_TYPE_NONE)
-				continue;
+			if (checksum_ctx->type != CHECKSUM_TYPE_NONE)
+			{
+				for (unsigned j = 0; j < nblocks; j++)
+				{
+					read_block(s, offsetmap[i] + (off_t) j * BLCKSZ, buffer);
 
-			read_block(s, offsetmap[i], buffer);
+					if (pg_checksum_update(checksum_ctx, buffer, BLCKSZ) < 0)
+						pg_fatal("could not update checksum of file \"%s\"",
+								 output_filename);
+				}
+			}
 
-			if (pg_checksum_update(checksum_ctx, buffer, BLCKSZ) < 0)
-				pg_fatal("could not update checksum of file \"%s\"",
-						 output_filename);
+			/* Skip over the additional blocks we just copied. */
+			i += nblocks - 1;
 #else
 			pg_fatal("copy_file_range not supported on this platform");
 #endif
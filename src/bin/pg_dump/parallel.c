@@ -48,6 +48,13 @@
  *		WRKR_TERMINATED: process ended
  * The pstate->te[] entry for each worker is valid when it's in WRKR_WORKING
  * state, and must be NULL in other states.
+ *
+ * The unit of work is a whole TocEntry, so a single large table is still
+ * dumped and restored by one worker.  Splitting it (say, into ctid ranges
+ * read under the shared snapshot) would need one TocEntry per chunk, or a
+ * chunk number in the DUMP/RESTORE commands, plus archive-format support
+ * for multiple data files per table and restore logic that creates indexes
+ * and constraints only after every chunk has been loaded.
  */
 
 #include "postgres_fe.h"
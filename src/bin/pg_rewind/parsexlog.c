@@ -61,6 +61,13 @@ static int	SimpleXLogPageRead(XLogReaderState *xlogreader,
  *
  * 'endpoint' is the end of the last record to read. The record starting at
  * 'endpoint' is the first one that is not read.
+ *
+ * When the target ran with summarize_wal enabled, its pg_wal/summaries could
+ * in principle supply the same block references without decoding every
+ * record.  We don't rely on them because summaries are written in the
+ * background and may not extend to the end of the target's WAL, so the
+ * remaining tail would have to be read this way anyway, and a summary that
+ * is missing or was removed must never cause a modified block to be missed.
  */
 void
 extractPageMap(const char *datadir, XLogRecPtr startpoint, int tliIndex,
@@ -364,6 +364,28 @@ typedef struct SimpleStats
 	double		sum2;			/* sum of squared values */
 } SimpleStats;
 
+/*
+ * Histogram of transaction latencies, used to report percentiles.
+ *
+ * Values (in microseconds) are bucketed on a log-linear scale: each power of
+ * two is split into 2^LATENCY_HIST_SUB_BITS equal-width buckets, so the
+ * relative error of a reported percentile is bounded by about 6% regardless
+ * of its magnitude.  Values below 2^LATENCY_HIST_SUB_BITS get exact buckets,
+ * and anything above 2^LATENCY_HIST_MAX_BITS us (about 19 hours) is clamped
+ * into the last bucket.
+ */
+#define LATENCY_HIST_SUB_BITS	4
+#define LATENCY_HIST_SUB_COUNT	(1 << LATENCY_HIST_SUB_BITS)
+#define LATENCY_HIST_MAX_BITS	36
+#define LATENCY_HIST_BUCKETS	\
+	((LATENCY_HIST_MAX_BITS - LATENCY_HIST_SUB_BITS + 1) * LATENCY_HIST_SUB_COUNT)
+
+typedef struct LatencyHistogram
+{
+	int64		count;			/* total number of values */
+	int64		buckets[LATENCY_HIST_BUCKETS];
+} LatencyHistogram;
+
 /*
  * The instr_time type is expensive when dealing with time arithmetic.  Define
  * a type to hold microseconds instead.  Type int64 is good enough for about
@@ -448,6 +470,7 @@ typedef struct StatsData
 									 * specified */
 	SimpleStats latency;
 	SimpleStats lag;
+	LatencyHistogram latency_hist;
 } StatsData;
 
 /*
@@ -822,6 +845,11 @@ static const BuiltinScript builtin_script[] =
 		"<builtin: select only>",
 		"\\set aid random(1, " CppAsString2(naccounts) " * :scale)\n"
 		"SELECT abalance FROM pgbench_accounts WHERE aid = :aid;\n"
+	},
+	{
+		"round-trip",
+		"<builtin: round trip>",
+		"SELECT 1;\n"
 	}
 };
 
@@ -1417,6 +1445,93 @@ mergeSimpleStats(SimpleStats *acc, SimpleStats *ss)
 	acc->sum2 += ss->sum2;
 }
 
+/*
+ * Accumulate one latency value (in microseconds) into a histogram.
+ */
+static void
+addToLatencyHistogram(LatencyHistogram *hist, double val)
+{
+	uint64		v;
+	int			bucket;
+
+	if (val <= 0)
+		v = 0;
+	else if (val >= (double) (UINT64CONST(1) << LATENCY_HIST_MAX_BITS))
+		v = (UINT64CONST(1) << LATENCY_HIST_MAX_BITS) - 1;
+	else
+		v = (uint64) val;
+
+	if (v < LATENCY_HIST_SUB_COUNT)
+		bucket = (int) v;
+	else
+	{
+		int			shift = pg_leftmost_one_pos64(v) - LATENCY_HIST_SUB_BITS;
+
+		bucket = (shift + 1) * LATENCY_HIST_SUB_COUNT +
+			(int) ((v >> shift) & (LATENCY_HIST_SUB_COUNT - 1));
+	}
+
+	Assert(bucket < LATENCY_HIST_BUCKETS);
+	hist->buckets[bucket]++;
+	hist->count++;
+}
+
+/*
+ * Merge two LatencyHistogram objects
+ */
+static void
+mergeLatencyHistogram(LatencyHistogram *acc, LatencyHistogram *hist)
+{
+	for (int i = 0; i < LATENCY_HIST_BUCKETS; i++)
+		acc->buckets[i] += hist->buckets[i];
+	acc->count += hist->count;
+}
+
+/*
+ * Return the approximate value (in microseconds) below which the given
+ * fraction of the histogram's values fall.  The midpoint of the bucket
+ * holding that rank is returned, clamped to the observed range in ss.
+ */
+static double
+getLatencyPercentile(LatencyHistogram *hist, SimpleStats *ss, double fraction)
+{
+	int64		rank;
+	int64		seen = 0;
+	double		val = 0.0;
+
+	Assert(hist->count > 0);
+
+	rank = (int64) ceil(fraction * hist->count);
+	if (rank < 1)
+		rank = 1;
+
+	for (int i = 0; i < LATENCY_HIST_BUCKETS; i++)
+	{
+		seen += hist->buckets[i];
+		if (seen >= rank)
+		{
+			if (i < LATENCY_HIST_SUB_COUNT)
+				val = i;
+			else
+			{
+				int			shift = i / LATENCY_HIST_SUB_COUNT - 1;
+				uint64		low;
+
+				low = (uint64) (LATENCY_HIST_SUB_COUNT + i % LATENCY_HIST_SUB_COUNT) << shift;
+				val = low + (double) (UINT64CONST(1) << shift) / 2;
+			}
+			break;
+		}
+	}
+
+	if (val < ss->min)
+		val = ss->min;
+	if (val > ss->max)
+		val = ss->max;
+
+	return val;
+}
+
 /*
  * Initialize a StatsData struct to mostly zeroes, with its start time set to
  * the given value.
@@ -1434,6 +1549,7 @@ initStats(StatsData *sd, pg_time_usec_t start)
 	sd->other_sql_failures = 0;
 	initSimpleStats(&sd->latency);
 	initSimpleStats(&sd->lag);
+	memset(&sd->latency_hist, 0, sizeof(LatencyHistogram));
 }
 
 /*
@@ -1468,6 +1584,7 @@ accumStats(StatsData *stats, bool skipped, double lat, double lag,
 			stats->cnt++;
 
 			addToSimpleStats(&stats->latency, lat);
+			addToLatencyHistogram(&stats->latency_hist, lat);
 
 			/* and possibly the same for schedule lag */
 			if (throttle_delay)
@@ -6410,6 +6527,17 @@ printSimpleStats(const char *prefix, SimpleStats *ss)
 	}
 }
 
+static void
+printLatencyPercentiles(const char *prefix, StatsData *sd)
+{
+	if (sd->latency_hist.count > 0)
+		printf("%s percentiles: p50 = %.3f ms, p99 = %.3f ms, p99.9 = %.3f ms\n",
+			   prefix,
+			   0.001 * getLatencyPercentile(&sd->latency_hist, &sd->latency, 0.5),
+			   0.001 * getLatencyPercentile(&sd->latency_hist, &sd->latency, 0.99),
+			   0.001 * getLatencyPercentile(&sd->latency_hist, &sd->latency, 0.999));
+}
+
 /* print version banner */
 static void
 printVersion(PGconn *con)
@@ -6525,7 +6653,10 @@ printResults(StatsData *total,
 			   (total->cnt > 0) ? 100.0 * latency_late / total->cnt : 0.0);
 
 	if (throttle_delay || progress || latency_limit)
+	{
 		printSimpleStats("latency", &total->latency);
+		printLatencyPercentiles("latency", total);
+	}
 	else
 	{
 		/* no measurement, show average latency computed from run time */
@@ -6634,6 +6765,7 @@ printResults(StatsData *total,
 
 				}
 				printSimpleStats(" - latency", &sstats->latency);
+				printLatencyPercentiles(" - latency", sstats);
 			}
 
 			/*
@@ -7481,6 +7613,7 @@ main(int argc, char **argv)
 		/* aggregate thread level stats */
 		mergeSimpleStats(&stats.latency, &thread->stats.latency);
 		mergeSimpleStats(&stats.lag, &thread->stats.lag);
+		mergeLatencyHistogram(&stats.latency_hist, &thread->stats.latency_hist);
 		stats.cnt += thread->stats.cnt;
 		stats.skipped += thread->stats.skipped;
 		stats.retries += thread->stats.retries;
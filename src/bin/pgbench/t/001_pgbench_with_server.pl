@@ -208,6 +208,18 @@ $node->pgbench(
 	],
 	'pgbench select only');
 
+$node->pgbench(
+	'-t 10 -c 2 -M prepared -b round-trip -n',
+	0,
+	[
+		qr{builtin: round trip},
+		qr{clients: 2\b},
+		qr{processed: 20/20},
+		qr{mode: prepared}
+	],
+	[qr{^$}],
+	'pgbench round trip');
+
 # check if threads are supported
 my $nthreads = 2;
 
@@ -1486,7 +1498,11 @@ for my $e (@errors)
 $node->pgbench(
 	'-t 100 -S --rate=100000 --latency-limit=1000000 -c 2 -n -r',
 	0,
-	[ qr{processed: 200/200}, qr{builtin: select only} ],
+	[
+		qr{processed: 200/200},
+		qr{builtin: select only},
+		qr{latency percentiles: p50 = }
+	],
 	[qr{^$}],
 	'pgbench throttling');
 
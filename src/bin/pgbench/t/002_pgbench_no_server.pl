@@ -244,7 +244,8 @@ pgbench(
 	[qr{^$}],
 	[
 		qr{Available builtin scripts:}, qr{tpcb-like},
-		qr{simple-update}, qr{select-only}
+		qr{simple-update}, qr{select-only},
+		qr{round-trip}
 	],
 	'pgbench builtin list');
 
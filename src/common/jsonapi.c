@@ -19,7 +19,7 @@
 
 #include "common/jsonapi.h"
 #include "mb/pg_wchar.h"
-#include "port/pg_lfind.h"
+#include "port/simd.h"
 
 #ifdef JSONAPI_USE_PQEXPBUFFER
 #include "pqexpbuffer.h"
@@ -2213,13 +2213,20 @@ json_lex_string(JsonLexContext *lex)
 
 			/*
 			 * Skip to the first byte that requires special handling, so we
-			 * can batch calls to jsonapi_appendBinaryStringInfo.
+			 * can batch calls to jsonapi_appendBinaryStringInfo.  Each chunk
+			 * is loaded once and tested for all three kinds of special byte.
 			 */
-			while (p < end - sizeof(Vector8) &&
-				   !pg_lfind8('\\', (const uint8 *) p, sizeof(Vector8)) &&
-				   !pg_lfind8('"', (const uint8 *) p, sizeof(Vector8)) &&
-				   !pg_lfind8_le(31, (const uint8 *) p, sizeof(Vector8)))
+			while (p < end - sizeof(Vector8))
+			{
+				Vector8		chunk;
+
+				vector8_load(&chunk, (const uint8 *) p);
+				if (vector8_has(chunk, (unsigned char) '\\') ||
+					vector8_has(chunk, (unsigned char) '"') ||
+					vector8_has_le(chunk, (unsigned char) 31))
+					break;
 				p += sizeof(Vector8);
+			}
 
 			for (; p < end; p++)
 			{
@@ -117,6 +117,9 @@ typedef IndexBuildResult *(*ambuild_function) (Relation heapRelation,
 /* build empty index */
 typedef void (*ambuildempty_function) (Relation indexRelation);
 
+/* can this index be built in parallel? */
+typedef bool (*ambuildparallelok_function) (Relation indexRelation);
+
 /* insert this tuple */
 typedef bool (*aminsert_function) (Relation indexRelation,
 								   Datum *values,
@@ -203,6 +206,12 @@ typedef bool (*amgettuple_function) (IndexScanDesc scan,
 typedef int64 (*amgetbitmap_function) (IndexScanDesc scan,
 									   TIDBitmap *tbm);
 
+/* peek at upcoming amgettuple results that point into a given heap block */
+typedef int (*amgetbatch_function) (IndexScanDesc scan,
+									BlockNumber heapblk,
+									ItemPointer tids,
+									int maxtids);
+
 /* end index scan */
 typedef void (*amendscan_function) (IndexScanDesc scan);
 
@@ -295,6 +304,7 @@ typedef struct IndexAmRoutine
 	/* interface functions */
 	ambuild_function ambuild;
 	ambuildempty_function ambuildempty;
+	ambuildparallelok_function ambuildparallelok;	/* can be NULL */
 	aminsert_function aminsert;
 	aminsertcleanup_function aminsertcleanup;	/* can be NULL */
 	ambulkdelete_function ambulkdelete;
@@ -311,6 +321,7 @@ typedef struct IndexAmRoutine
 	amrescan_function amrescan;
 	amgettuple_function amgettuple; /* can be NULL */
 	amgetbitmap_function amgetbitmap;	/* can be NULL */
+	amgetbatch_function amgetbatch; /* can be NULL */
 	amendscan_function amendscan;
 	ammarkpos_function ammarkpos;	/* can be NULL */
 	amrestrpos_function amrestrpos; /* can be NULL */
@@ -20,6 +20,10 @@
 #include "lib/pairingheap.h"
 #include "storage/bufmgr.h"
 #include "storage/buffile.h"
+#include "storage/condition_variable.h"
+#include "storage/dsm.h"
+#include "storage/shm_toc.h"
+#include "storage/spin.h"
 #include "utils/hsearch.h"
 #include "access/genam.h"
 
@@ -180,6 +184,36 @@ typedef struct GISTScanOpaqueData
 
 typedef GISTScanOpaqueData *GISTScanOpaque;
 
+/*
+ * State of a parallel GiST scan.  The first participant to arrive reads the
+ * root page and publishes the downlinks that satisfy the scan keys; after
+ * that, each participant repeatedly claims one of those subtrees and scans
+ * it to completion using its own private queue.
+ */
+typedef enum
+{
+	GISTPARALLEL_NOT_INITIALIZED,
+	GISTPARALLEL_ADVANCING,		/* root page is being read */
+	GISTPARALLEL_READY,			/* subtrees are available to be claimed */
+} GISTPS_State;
+
+/*
+ * GISTParallelScanDescData contains GiST specific shared information
+ * required for parallel scan.
+ */
+typedef struct GISTParallelScanDescData
+{
+	slock_t		gps_mutex;		/* protects the fields below */
+	GISTPS_State gps_state;
+	ConditionVariable gps_cv;	/* signaled when gps_state becomes READY */
+	GistNSN		gps_rootlsn;	/* LSN of the root page when it was read */
+	int			gps_nchildren;	/* number of entries in gps_children */
+	int			gps_nextchild;	/* next entry of gps_children to claim */
+	BlockNumber gps_children[FLEXIBLE_ARRAY_MEMBER];
+} GISTParallelScanDescData;
+
+typedef GISTParallelScanDescData *GISTParallelScanDesc;
+
 /* despite the name, gistxlogPage is not part of any xlog record */
 typedef struct gistxlogPage
 {
@@ -544,8 +578,10 @@ extern void gistSplitByKey(Relation r, Page page, IndexTuple *itup,
 						   int attno);
 
 /* gistbuild.c */
+extern bool gistbuildparallelok(Relation index);
 extern IndexBuildResult *gistbuild(Relation heap, Relation index,
 								   struct IndexInfo *indexInfo);
+extern void _gist_parallel_build_main(dsm_segment *seg, shm_toc *toc);
 
 /* gistbuildbuffers.c */
 extern GISTBuildBuffers *gistInitBuildBuffers(int pagesPerBuffer, int levelStep,
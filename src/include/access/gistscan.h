@@ -20,5 +20,8 @@ extern IndexScanDesc gistbeginscan(Relation r, int nkeys, int norderbys);
 extern void gistrescan(IndexScanDesc scan, ScanKey key, int nkeys,
 					   ScanKey orderbys, int norderbys);
 extern void gistendscan(IndexScanDesc scan);
+extern Size gistestimateparallelscan(Relation rel, int nkeys, int norderbys);
+extern void gistinitparallelscan(void *target);
+extern void gistparallelrescan(IndexScanDesc scan);
 
 #endif							/* GISTSCAN_H */
@@ -130,6 +130,17 @@ typedef struct IndexFetchHeapData
 
 	/* Current heap block's corresponding page in the visibility map */
 	Buffer		xs_vmbuffer;
+
+	/*
+	 * Results of checking the visibility of a batch of upcoming TIDs on
+	 * xs_blk together, under one buffer lock.  xs_batch is allocated on first
+	 * use; xs_nbatch is 0 when there are no valid results.
+	 */
+	struct IndexFetchHeapBatchItem *xs_batch;
+	int			xs_nbatch;		/* number of valid xs_batch entries */
+	int			xs_nextbatch;	/* entry likely to be needed next */
+	Snapshot	xs_batchsnapshot;	/* snapshot used for xs_batch results */
+	CommandId	xs_batchcid;	/* ... and its curcid at the time */
 } IndexFetchHeapData;
 
 /* Result codes for HeapTupleSatisfiesVacuum */
@@ -120,6 +120,17 @@ typedef struct ParallelBlockTableScanWorkerData
 } ParallelBlockTableScanWorkerData;
 typedef struct ParallelBlockTableScanWorkerData *ParallelBlockTableScanWorker;
 
+/*
+ * Callback that a table AM can use to learn about the TIDs an index scan
+ * will ask it to fetch next (see amgetbatch).  It stores up to maxtids
+ * upcoming TIDs pointing into table block blkno, starting with the TID being
+ * fetched, and returns the number it stored.
+ */
+typedef int (*IndexFetchBatchCB) (void *callback_private_data,
+								  BlockNumber blkno,
+								  ItemPointer tids,
+								  int maxtids);
+
 /*
  * Base class for fetches from a table via an index. This is the base-class
  * for such scans, which needs to be embedded in the respective struct for
@@ -134,6 +145,13 @@ typedef struct IndexFetchTableData
 	 * permitted.
 	 */
 	uint32		flags;
+
+	/*
+	 * Source of upcoming TIDs, set up by index_beginscan when the index AM
+	 * supports amgetbatch (NULL otherwise).
+	 */
+	IndexFetchBatchCB batch_cb;
+	void	   *batch_cb_private_data;
 } IndexFetchTableData;
 
 struct IndexScanInstrumentation;
@@ -128,6 +128,12 @@ typedef enum TM_Result
 /*
  * Result codes for table_update(..., update_indexes*..).
  * Used to determine which indexes to update.
+ *
+ * An AM that updates tuples in place, keeping the old version elsewhere
+ * (an undo log, say), can report TU_None whenever no indexed column
+ * changed, since the TID stays the same.  Such an AM would have to do its
+ * own visibility checks for index scans, since the index entries would
+ * then refer to all versions at once.
  */
 typedef enum TU_UpdateIndexes
 {
@@ -488,6 +494,10 @@ typedef struct TableAmRoutine
 	 * index_fetch_tuple iff it is guaranteed that no backend needs to see
 	 * that tuple. Index AMs can use that to avoid returning that tid in
 	 * future searches.
+	 *
+	 * If scan->batch_cb is set, the AM may use it to learn which tids will
+	 * be fetched next, e.g. to check the visibility of all the tids pointing
+	 * into one block together.
 	 */
 	bool		(*index_fetch_tuple) (struct IndexFetchTableData *scan,
 									  ItemPointer tid,
@@ -1245,6 +1255,8 @@ table_parallelscan_reinitialize(Relation rel, ParallelTableScanDesc pscan)
 static inline IndexFetchTableData *
 table_index_fetch_begin(Relation rel, uint32 flags)
 {
+	IndexFetchTableData *scan;
+
 	Assert((flags & SO_INTERNAL_FLAGS) == 0);
 
 	/*
@@ -1255,7 +1267,13 @@ table_index_fetch_begin(Relation rel, uint32 flags)
 	if (unlikely(TransactionIdIsValid(CheckXidAlive) && !bsysscan))
 		elog(ERROR, "scan started during logical decoding");
 
-	return rel->rd_tableam->index_fetch_begin(rel, flags);
+	scan = rel->rd_tableam->index_fetch_begin(rel, flags);
+
+	/* index_beginscan sets up a batch callback when it can provide one */
+	scan->batch_cb = NULL;
+	scan->batch_cb_private_data = NULL;
+
+	return scan;
 }
 
 /*
@@ -34,6 +34,12 @@ extern PGDLLIMPORT XLogRecPtr ProcLastRecPtr;
 extern PGDLLIMPORT XLogRecPtr XactLastRecEnd;
 extern PGDLLIMPORT XLogRecPtr XactLastCommitEnd;
 
+/*
+ * Maximum value of wal_insert_locks.  WALInsertLockAcquireExclusive() holds
+ * all of them at once, so this must stay well below MAX_SIMUL_LWLOCKS.
+ */
+#define MAX_WAL_INSERT_LOCKS	128
+
 /* these variables are GUC parameters related to XLOG */
 extern PGDLLIMPORT int wal_segment_size;
 extern PGDLLIMPORT int min_wal_size_mb;
@@ -41,6 +47,7 @@ extern PGDLLIMPORT int max_wal_size_mb;
 extern PGDLLIMPORT int wal_keep_size_mb;
 extern PGDLLIMPORT int max_slot_wal_keep_size_mb;
 extern PGDLLIMPORT int XLOGbuffers;
+extern PGDLLIMPORT int NumXLogInsertLocks;
 extern PGDLLIMPORT int XLogArchiveTimeout;
 extern PGDLLIMPORT int wal_retrieve_retry_interval;
 extern PGDLLIMPORT char *XLogArchiveCommand;
@@ -37,6 +37,16 @@
  * The XLogRecordBlockHeader, XLogRecordDataHeaderShort and
  * XLogRecordDataHeaderLong structs all begin with a single 'id' byte. It's
  * used to distinguish between block references, and the main data structs.
+ *
+ * The format already avoids some redundancy: lengths below 256 bytes use the
+ * short data header, and a block reference to the same relation as the
+ * previous one in the record omits the RelFileLocator (BKPBLOCK_SAME_REL).
+ * Going further, e.g. with variable-length integers or with block references
+ * that refer back to an earlier record, would make each record harder to
+ * decode in isolation: xl_prev and the per-record CRC let the reader detect a
+ * torn or recycled WAL page at any record boundary, and logical decoding,
+ * pg_waldump and replication starting points all rely on a record being
+ * self-describing.
  */
 typedef struct XLogRecord
 {
@@ -57,6 +57,6 @@
  */
 
 /*							yyyymmddN */
-#define CATALOG_VERSION_NO	202607201
+#define CATALOG_VERSION_NO	202610141
 
 #endif
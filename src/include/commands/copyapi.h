@@ -19,6 +19,11 @@
 /*
  * API structure for a COPY TO format implementation. Note this must be
  * allocated in a server-lifetime manner, typically as a static const struct.
+ *
+ * Rows are delivered one at a time.  A columnar output format (Arrow IPC,
+ * for example) can still be built on this interface by accumulating rows
+ * into per-column buffers in CopyToOneRow, emitting a batch whenever enough
+ * rows have been collected, and flushing the remainder in CopyToEnd.
  */
 typedef struct CopyToRoutine
 {
@@ -14,6 +14,7 @@
 #ifndef HASHJOIN_H
 #define HASHJOIN_H
 
+#include "lib/bloomfilter.h"
 #include "nodes/execnodes.h"
 #include "port/atomics.h"
 #include "storage/barrier.h"
@@ -79,6 +80,16 @@
  * the tuple into a tuplestore and emit it later.  (In the unlikely but
  * supported case of a non-strict join operator, we treat null keys as normal
  * data.)
+ *
+ * Within a batch the hash table is a single array of bucket chains, sized so
+ * that the number of buckets is about the number of tuples.  Once the table
+ * is much larger than the CPU caches, each probe usually costs a cache miss
+ * for the bucket header and another for each chain entry examined; the
+ * hashvalue stored in each tuple lets us skip most non-matching entries
+ * without touching the tuple data.  A radix-partitioned design, which would
+ * split each batch further into cache-sized partitions and probe them one at
+ * a time, would have to buffer the outer tuples of a batch in memory too,
+ * and would no longer emit join output in outer-tuple order within a batch.
  * ----------------------------------------------------------------
  */
 
@@ -338,6 +349,11 @@ typedef struct HashJoinTableData
 
 	bool		growEnabled;	/* flag to shut off nbatch increases */
 
+	/* hash values of all inner tuples, if we are filtering outer tuples */
+	bloom_filter *bloomFilter;
+	Size		bloomSpace;		/* memory used by bloomFilter, in bytes */
+	int64		bloomRejected;	/* outer tuples that failed bloomFilter */
+
 	/*
 	 * totalTuples is the running total of tuples inserted into either the
 	 * main or skew hash tables.  reportTuples is the number of tuples that we
@@ -227,6 +227,8 @@ typedef struct HashInstrumentation
 	int			nbatch;			/* number of batches at end of execution */
 	int			nbatch_original;	/* planned number of batches */
 	Size		space_peak;		/* peak memory usage in bytes */
+	Size		bloom_space;	/* size of the Bloom filter in bytes */
+	int64		bloom_rejected; /* outer tuples removed by the Bloom filter */
 } HashInstrumentation;
 
 /*
@@ -90,6 +90,7 @@ extern PGDLLIMPORT bool jit_tuple_deforming;
 extern PGDLLIMPORT double jit_above_cost;
 extern PGDLLIMPORT double jit_inline_above_cost;
 extern PGDLLIMPORT double jit_optimize_above_cost;
+extern PGDLLIMPORT int jit_warmup_calls;
 
 
 extern void jit_reset_after_error(void);
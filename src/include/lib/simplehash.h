@@ -87,6 +87,16 @@
  *	  looking or is done - buckets following a deleted element are shifted
  *	  backwards, unless they're empty or already at their optimal position.
  *
+ *	  Because robin hood probing keeps the expected probe length short, and
+ *	  with SH_STORE_HASH a non-matching bucket is usually rejected by a single
+ *	  integer comparison within the same cache line, a lookup rarely touches
+ *	  more than one or two cache lines of the bucket array.  A "Swiss table"
+ *	  style of layout, with a separate array of per-bucket control bytes
+ *	  scanned several at a time with SIMD instructions, would mainly help
+ *	  when elements are large or the hash is not stored; for callers whose
+ *	  SH_EQUAL must dereference a pointer, as execGrouping.c's does, the miss
+ *	  on the pointed-to key tends to dominate either way.
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -2505,6 +2505,13 @@ typedef struct AggState
 	AggStatePerGroup *all_pergroups;	/* array of first ->pergroups, than
 										 * ->hash_pergroup */
 	SharedAggInfo *shared_info; /* one entry per worker */
+
+	/* these fields are used for partial aggregation in AGG_HASHED mode: */
+	bool		hash_early_emit;	/* emit groups rather than spill? */
+	bool		hash_emit_pending;	/* emitting a full table; more input to
+									 * be read afterwards */
+	bool		hash_ever_emitted;	/* ever emitted early during this
+									 * execution? */
 } AggState;
 
 /* ----------------
@@ -20,9 +20,18 @@
 /*
  * allpaths.c
  */
+
+/* possible values for geqo_strategy */
+typedef enum
+{
+	GEQO_STRATEGY_GENETIC,
+	GEQO_STRATEGY_GREEDY,
+} GeqoStrategy;
+
 extern PGDLLIMPORT bool enable_geqo;
 extern PGDLLIMPORT bool enable_eager_aggregate;
 extern PGDLLIMPORT int geqo_threshold;
+extern PGDLLIMPORT int geqo_strategy;
 extern PGDLLIMPORT double min_eager_agg_group_size;
 extern PGDLLIMPORT int min_parallel_table_scan_size;
 extern PGDLLIMPORT int min_parallel_index_scan_size;
@@ -61,6 +70,8 @@ extern PGDLLIMPORT join_search_hook_type join_search_hook;
 extern RelOptInfo *make_one_rel(PlannerInfo *root, List *joinlist);
 extern RelOptInfo *standard_join_search(PlannerInfo *root, int levels_needed,
 										List *initial_rels);
+extern RelOptInfo *greedy_join_search(PlannerInfo *root, int levels_needed,
+									  List *initial_rels);
 
 extern void generate_gather_paths(PlannerInfo *root, RelOptInfo *rel,
 								  bool override_rows);
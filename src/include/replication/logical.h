@@ -112,6 +112,13 @@ typedef struct LogicalDecodingContext
 
 	/* Do we need to process any change in fast_forward mode? */
 	bool		processing_required;
+
+	/*
+	 * Results of filter_by_relation_cb, by relfilelocator, and the
+	 * invalidation generation they are valid for.  See decode.c.
+	 */
+	HTAB	   *relfilter_cache;
+	uint64		relfilter_generation;
 } LogicalDecodingContext;
 
 
@@ -146,6 +153,7 @@ extern void LogicalConfirmReceivedLocation(XLogRecPtr lsn);
 extern bool filter_prepare_cb_wrapper(LogicalDecodingContext *ctx,
 									  TransactionId xid, const char *gid);
 extern bool filter_by_origin_cb_wrapper(LogicalDecodingContext *ctx, ReplOriginId origin_id);
+extern bool filter_by_relation_cb_wrapper(LogicalDecodingContext *ctx, Relation relation);
 extern void ResetLogicalStreamingState(void);
 extern void UpdateDecodingStats(LogicalDecodingContext *ctx);
 
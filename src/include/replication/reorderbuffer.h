@@ -668,6 +668,10 @@ struct ReorderBuffer
 	char	   *outbuf;
 	Size		outbufsize;
 
+	/* buffer for compressing and decompressing spilled changes */
+	char	   *compressbuf;
+	Size		compressbufsize;
+
 	/* memory accounting */
 	Size		size;
 
@@ -763,6 +767,7 @@ extern void ReorderBufferProcessXid(ReorderBuffer *rb, TransactionId xid, XLogRe
 
 extern void ReorderBufferXidSetCatalogChanges(ReorderBuffer *rb, TransactionId xid, XLogRecPtr lsn);
 extern bool ReorderBufferXidHasCatalogChanges(ReorderBuffer *rb, TransactionId xid);
+extern bool ReorderBufferXidTopHasCatalogChanges(ReorderBuffer *rb, TransactionId xid);
 extern bool ReorderBufferXidHasBaseSnapshot(ReorderBuffer *rb, TransactionId xid);
 
 extern bool ReorderBufferRememberPrepareInfo(ReorderBuffer *rb, TransactionId xid,
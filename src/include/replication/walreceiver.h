@@ -28,6 +28,14 @@
 extern PGDLLIMPORT int wal_receiver_status_interval;
 extern PGDLLIMPORT int wal_receiver_timeout;
 extern PGDLLIMPORT bool hot_standby_feedback;
+extern PGDLLIMPORT int wal_receiver_compression;
+
+/* Compression methods for wal_receiver_compression */
+typedef enum WalRcvCompression
+{
+	WAL_RCV_COMPRESSION_OFF,
+	WAL_RCV_COMPRESSION_LZ4,
+} WalRcvCompression;
 
 /*
  * MAXCONNINFO: maximum size of a connection string.
@@ -177,6 +185,8 @@ typedef struct
 		struct
 		{
 			TimeLineID	startpointTLI;	/* Starting timeline */
+			char	   *compression;	/* Compression method to ask the
+										 * primary for, or NULL */
 		}			physical;
 		struct
 		{
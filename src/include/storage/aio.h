@@ -364,6 +364,7 @@ extern void pgaio_closing_fd(int fd);
 /* GUCs */
 extern PGDLLIMPORT int io_method;
 extern PGDLLIMPORT int io_max_concurrency;
+extern PGDLLIMPORT bool io_uring_fixed_buffers;
 
 
 #endif							/* AIO_H */
@@ -45,6 +45,7 @@ extern void BufFileWrite(BufFile *file, const void *ptr, size_t size);
 extern int	BufFileSeek(BufFile *file, int fileno, pgoff_t offset, int whence);
 extern void BufFileTell(BufFile *file, int *fileno, pgoff_t *offset);
 extern int	BufFileSeekBlock(BufFile *file, int64 blknum);
+extern void BufFilePrefetchBlock(BufFile *file, int64 blknum);
 extern int64 BufFileSize(BufFile *file);
 extern int64 BufFileAppend(BufFile *target, BufFile *source);
 
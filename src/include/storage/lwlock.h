@@ -82,8 +82,14 @@ extern PGDLLIMPORT LWLockPadded *MainLWLockArray;
 /* Number of partitions of the shared buffer mapping hashtable */
 #define NUM_BUFFER_PARTITIONS  128
 
-/* Number of partitions the shared lock tables are divided into */
-#define LOG2_NUM_LOCK_PARTITIONS  4
+/*
+ * Number of partitions the shared lock tables are divided into.  More
+ * partitions reduce contention when many backends acquire locks that don't
+ * fit in their fast-path slots, at the cost of a larger per-PGPROC
+ * myProcLocks array and more LWLocks to take in the rare operations that
+ * must lock every partition (deadlock detection, pg_locks).
+ */
+#define LOG2_NUM_LOCK_PARTITIONS  6
 #define NUM_LOCK_PARTITIONS  (1 << LOG2_NUM_LOCK_PARTITIONS)
 
 /* Number of partitions the shared predicate lock tables are divided into */
@@ -15,6 +15,7 @@
 #define _PROC_H_
 
 #include "access/xlogdefs.h"
+#include "datatype/timestamp.h"
 #include "lib/ilist.h"
 #include "miscadmin.h"
 #include "storage/latch.h"
@@ -377,6 +378,19 @@ typedef struct PGPROC
 	XLogRecPtr	clogGroupMemberLsn; /* WAL location of commit record for clog
 									 * group member */
 
+	/************************************************************************
+	 * Support for group commit timestamp update
+	 ************************************************************************/
+
+	bool		commitTsGroupMember;	/* true, if member of commit_ts group */
+	pg_atomic_uint32 commitTsGroupNext; /* next commit_ts group member */
+	TransactionId commitTsGroupMemberXid;	/* transaction id of commit_ts
+											 * group member */
+	TimestampTz commitTsGroupMemberTime;	/* commit timestamp to record */
+	ReplOriginId commitTsGroupMemberNodeId; /* replication origin to record */
+	int64		commitTsGroupMemberPage;	/* commit_ts page corresponding to
+											 * transaction id of group member */
+
 	/************************************************************************
 	 * Status reporting
 	 ************************************************************************/
@@ -486,6 +500,8 @@ typedef struct PROC_HDR
 	pg_atomic_uint32 procArrayGroupFirst;
 	/* First pgproc waiting for group transaction status update */
 	pg_atomic_uint32 clogGroupFirst;
+	/* First pgproc waiting for group commit timestamp update */
+	pg_atomic_uint32 commitTsGroupFirst;
 
 	/*
 	 * Current proc numbers of some auxiliary processes. There can be only one
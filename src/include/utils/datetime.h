@@ -311,6 +311,9 @@ extern int	date2j(int year, int month, int day);
 extern int	ParseDateTime(const char *timestr, char *workbuf, size_t buflen,
 						  char **field, int *ftype,
 						  int maxfields, int *numfields);
+extern bool DecodeISODateTimeFast(const char *str, struct pg_tm *tm,
+								  fsec_t *fsec, bool *have_time,
+								  bool *have_tz, int *tz);
 extern int	DecodeDateTime(char **field, int *ftype, int nf,
 						   int *dtype, struct pg_tm *tm, fsec_t *fsec, int *tzp,
 						   DateTimeErrorExtra *extra);
@@ -188,6 +188,14 @@ typedef uint32 JEntry;
  * first, in key sort order; then the values appear, in an order matching the
  * key order.  This arrangement keeps the keys compact in memory, making a
  * search for a particular key more cache-friendly.
+ *
+ * The same arrangement would in principle allow a lookup of one key in a
+ * large toasted object to fetch only a prefix of the datum (root header,
+ * JEntry array and keys) plus the byte range of the matching value, using
+ * detoast_attr_slice().  We don't do that today: the accessors all take a
+ * fully detoasted Jsonb, and for compressed values neither pglz nor lz4 can
+ * start decompressing in the middle of a datum, so only values stored with
+ * STORAGE EXTERNAL would benefit without a seekable compression format.
  */
 typedef struct JsonbContainer
 {
@@ -433,6 +441,8 @@ extern JsonbValue *getIthJsonbValueFromContainer(JsonbContainer *container,
 												 uint32 i);
 extern void pushJsonbValue(JsonbInState *pstate,
 						   JsonbIteratorToken seq, JsonbValue *jbval);
+extern void pushJsonbBinaryValue(JsonbInState *pstate,
+								 JsonbIteratorToken seq, JsonbValue *jbval);
 extern JsonbIterator *JsonbIteratorInit(JsonbContainer *container);
 extern JsonbIteratorToken JsonbIteratorNext(JsonbIterator **it, JsonbValue *val,
 											bool skipNested);
@@ -40,7 +40,8 @@ typedef struct varatt_external
 
 /*
  * These macros define the "saved size" portion of va_extinfo.  Its remaining
- * two high-order bits identify the compression method.
+ * two high-order bits identify the compression method: pglz, lz4 or zstd,
+ * see ToastCompressionId.  The fourth value is not used yet.
  */
 #define VARLENA_EXTSIZE_BITS	30
 #define VARLENA_EXTSIZE_MASK	((1U << VARLENA_EXTSIZE_BITS) - 1)
@@ -520,7 +521,8 @@ VARATT_EXTERNAL_GET_COMPRESS_METHOD(varatt_external toast_pointer)
 #define VARATT_EXTERNAL_SET_SIZE_AND_COMPRESS_METHOD(toast_pointer, len, cm) \
 	do { \
 		Assert((cm) == TOAST_PGLZ_COMPRESSION_ID || \
-			   (cm) == TOAST_LZ4_COMPRESSION_ID); \
+			   (cm) == TOAST_LZ4_COMPRESSION_ID || \
+			   (cm) == TOAST_ZSTD_COMPRESSION_ID); \
 		((toast_pointer).va_extinfo = \
 			(len) | ((uint32) (cm) << VARLENA_EXTSIZE_BITS)); \
 	} while (0)
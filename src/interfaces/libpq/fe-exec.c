@@ -1218,6 +1218,15 @@ pqSaveParameterStatus(PGconn *conn, const char *name, const char *value)
  * On error, *errmsgp can be set to an error string to be returned.
  * (Such a string should already be translated via libpq_gettext().)
  * If it is left NULL, the error is presumed to be "out of memory".
+ *
+ * Every row is copied into PGresult-owned storage, even in chunked mode.
+ * Letting applications consume conn->rowBuf directly (for instance, to
+ * scatter binary fields into their own columnar buffers) would avoid that
+ * copy, but the values point into conn->inBuffer and are only valid until
+ * the next input is read, and a callback run from inside the protocol
+ * parser cannot safely longjmp or re-enter libpq.  An earlier public
+ * row-processor hook was withdrawn for exactly those reasons, so any
+ * replacement needs a design that keeps the application out of the parser.
  */
 int
 pqRowProcessor(PGconn *conn, const char **errmsgp)
@@ -3,6 +3,15 @@
  * pl_comp.c		- Compiler part of the PL/pgSQL
  *			  procedural language
  *
+ * "Compiling" here means parsing the function body into a tree of
+ * PLpgSQL_stmt nodes and setting up the datums array; pl_exec.c then
+ * interprets that tree directly.  Expressions are not planned until first
+ * executed, because their plans depend on the types of variables, search
+ * path and other state that can change between calls, and the per-
+ * statement cost is usually dominated by expression evaluation in the main
+ * executor anyway.  Lowering statements to a flat instruction stream would
+ * mostly save the statement dispatch in exec_stmts().
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
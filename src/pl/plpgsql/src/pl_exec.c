@@ -4233,6 +4233,14 @@ exec_prepare_plan(PLpgSQL_execstate *estate,
 /* ----------
  * exec_stmt_execsql			Execute an SQL statement (possibly with INTO).
  *
+ * Unlike simple expressions (see exec_eval_simple_expr), statements that
+ * read or modify tables always go through SPI, which sets up a new
+ * executor state for each execution.  Caching an EState across executions
+ * the way simple expressions do would require the executor to support
+ * rescanning a whole plan tree with new parameters and a new snapshot, and
+ * DML would additionally need its own AFTER trigger and command counter
+ * handling; SPI takes care of those things for us.
+ *
  * Note: some callers rely on this not touching stmt_mcontext.  If it ever
  * needs to use that, fix those callers to push/pop stmt_mcontext.
  * ----------
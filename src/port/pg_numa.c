@@ -118,6 +118,22 @@ pg_numa_get_max_node(void)
 	return numa_max_node();
 }
 
+/*
+ * Set the memory policy of the given (page-aligned) range so that its pages
+ * are interleaved across all NUMA nodes when first touched.  Returns 0 on
+ * success, or -1 with errno set.
+ *
+ * We call mbind(2) directly rather than numa_interleave_memory(), because
+ * the latter doesn't report errors to the caller.
+ */
+int
+pg_numa_interleave_memory(void *ptr, size_t size)
+{
+	struct bitmask *nodes = numa_all_nodes_ptr;
+
+	return mbind(ptr, size, MPOL_INTERLEAVE, nodes->maskp, nodes->size + 1, 0);
+}
+
 #else
 
 /* Empty wrappers */
@@ -140,4 +156,11 @@ pg_numa_get_max_node(void)
 	return 0;
 }
 
+int
+pg_numa_interleave_memory(void *ptr, size_t size)
+{
+	errno = ENOSYS;
+	return -1;
+}
+
 #endif
@@ -321,6 +321,7 @@ dihandler(PG_FUNCTION_ARGS)
 
 		.ambuild = dibuild,
 		.ambuildempty = dibuildempty,
+		.ambuildparallelok = NULL,
 		.aminsert = diinsert,
 		.ambulkdelete = dibulkdelete,
 		.amvacuumcleanup = divacuumcleanup,
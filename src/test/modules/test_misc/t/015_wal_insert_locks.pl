@@ -0,0 +1,51 @@
+# Copyright (c) 2026, PostgreSQL Global Development Group
+
+# Test the range of values accepted for wal_insert_locks.
+
+use strict;
+use warnings FATAL => 'all';
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+
+my $node = PostgreSQL::Test::Cluster->new('main');
+$node->init();
+$node->append_conf('postgresql.conf', 'wal_insert_locks = 4');
+$node->start;
+
+is($node->safe_psql('postgres', 'SHOW wal_insert_locks'),
+	'4', 'explicit wal_insert_locks is used');
+
+# ALTER SYSTEM runs the check hook, so it can be used to test the values
+# accepted without restarting the server.
+my ($ret, $stdout, $stderr) =
+  $node->psql('postgres', 'ALTER SYSTEM SET wal_insert_locks = 0');
+isnt($ret, 0, 'wal_insert_locks = 0 is rejected');
+like(
+	$stderr,
+	qr/invalid value for parameter "wal_insert_locks": 0/,
+	'wal_insert_locks = 0 reports an invalid value');
+
+($ret, $stdout, $stderr) =
+  $node->psql('postgres', 'ALTER SYSTEM SET wal_insert_locks = 129');
+isnt($ret, 0, 'wal_insert_locks above the maximum is rejected');
+
+$node->safe_psql('postgres', 'ALTER SYSTEM SET wal_insert_locks = 1');
+$node->safe_psql('postgres', 'ALTER SYSTEM SET wal_insert_locks = 128');
+$node->safe_psql('postgres', 'ALTER SYSTEM SET wal_insert_locks = -1');
+
+# -1 is auto-tuned at startup
+$node->restart;
+isnt($node->safe_psql('postgres', 'SHOW wal_insert_locks'),
+	'-1', 'wal_insert_locks = -1 is auto-tuned');
+$node->safe_psql('postgres',
+	'CREATE TABLE t AS SELECT generate_series(1, 100) a');
+
+# The server refuses to start with zero locks
+$node->safe_psql('postgres', 'ALTER SYSTEM RESET wal_insert_locks');
+$node->stop;
+$node->append_conf('postgresql.conf', 'wal_insert_locks = 0');
+ok(!$node->start(fail_ok => 1),
+	'server does not start with wal_insert_locks = 0');
+
+done_testing();
@@ -0,0 +1,115 @@
+# Copyright (c) 2026, PostgreSQL Global Development Group
+
+# Test that stale entries in a backend's buffer lookaside cache, which
+# BufferAlloc() consults before the buffer mapping table, fall back to the
+# regular buffer lookup.
+
+use strict;
+use warnings FATAL => 'all';
+
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+
+if ($ENV{enable_injection_points} ne 'yes')
+{
+	plan skip_all => 'Injection points not supported by this build';
+}
+
+# Node initialization
+my $node = PostgreSQL::Test::Cluster->new('node');
+$node->init();
+$node->start;
+
+if (!$node->check_extension('injection_points'))
+{
+	plan skip_all => 'Extension injection_points not installed';
+}
+
+$node->safe_psql(
+	'postgres', q[
+    CREATE EXTENSION injection_points;
+    CREATE EXTENSION pg_buffercache;
+    CREATE TABLE lookaside_tbl (id int) WITH (autovacuum_enabled = off);
+    INSERT INTO lookaside_tbl SELECT generate_series(1, 100);
+]);
+
+my $psql_session = $node->background_psql('postgres', on_error_stop => 0);
+
+# Read the table once, so that its block is remembered in the lookaside
+# cache of the session.  The notice action reports every time the session
+# finds a lookaside entry that has gone stale.
+$psql_session->query(
+	q[
+    SELECT injection_points_set_local();
+    SELECT injection_points_attach('buffer-lookaside-stale', 'notice');
+    SELECT count(*) FROM lookaside_tbl;
+]);
+$psql_session->{stderr} = '';
+
+my $output = $psql_session->query('SELECT count(*) FROM lookaside_tbl;');
+is($output, '100', 'read through a valid lookaside entry');
+unlike(
+	$psql_session->{stderr},
+	qr/buffer-lookaside-stale/,
+	'valid lookaside entry is used');
+
+# Evict the block from another session.  The session's entry now points to
+# a buffer that no longer holds the page, and has to be ignored.
+$node->safe_psql('postgres',
+	"SELECT pg_buffercache_evict_relation('lookaside_tbl')");
+
+$output = $psql_session->query('SELECT count(*) FROM lookaside_tbl;');
+is($output, '100', 'read after eviction of the remembered buffer');
+like(
+	$psql_session->{stderr},
+	qr/notice triggered for injection point buffer-lookaside-stale/,
+	'stale lookaside entry is detected after eviction');
+$psql_session->{stderr} = '';
+
+# Now evict the block while the session is about to pin the remembered
+# buffer.  The session pins the buffer, finds that its tag no longer
+# matches, and must unpin it and do the regular lookup.
+$psql_session->query(
+	q[
+    SELECT count(*) FROM lookaside_tbl;
+    SELECT injection_points_attach('buffer-lookaside-before-pin', 'wait');
+]);
+$psql_session->{stderr} = '';
+
+$psql_session->query_until(
+	qr/starting_bg_psql/, q(
+   \echo starting_bg_psql
+   SELECT count(*) FROM lookaside_tbl;
+));
+$node->wait_for_event('client backend', 'buffer-lookaside-before-pin');
+
+# Detach the wait point before waking up the session, so that it doesn't
+# stop again at the next lookaside hit.
+$node->safe_psql(
+	'postgres', q[
+    SELECT pg_buffercache_evict_relation('lookaside_tbl');
+    SELECT injection_points_detach('buffer-lookaside-before-pin');
+    SELECT injection_points_wakeup('buffer-lookaside-before-pin');
+]);
+
+# Collect the result of the paused query.
+$output = $psql_session->query('SELECT 1;');
+like($output, qr/^100$/m, 'read after eviction of the buffer being pinned');
+like(
+	$psql_session->{stderr},
+	qr/notice triggered for injection point buffer-lookaside-stale/,
+	'stale lookaside entry is detected after pinning');
+
+# The regular lookup remembered the newly read buffer.
+$psql_session->{stderr} = '';
+$output = $psql_session->query('SELECT count(*) FROM lookaside_tbl;');
+is($output, '100', 'read through the refreshed lookaside entry');
+unlike(
+	$psql_session->{stderr},
+	qr/buffer-lookaside-stale/,
+	'refreshed lookaside entry is used');
+
+ok($psql_session->quit);
+
+done_testing();
@@ -0,0 +1,216 @@
+# Copyright (c) 2026, PostgreSQL Global Development Group
+
+# Run a fixed set of executor and storage workloads and record how long each
+# one takes, along with the I/O and WAL it caused, as JSON.  If a baseline
+# file from an earlier run is given, compare against it.  See README.
+use strict;
+use warnings FATAL => 'all';
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+use JSON::PP qw(decode_json);
+use Time::HiRes qw(time);
+
+if (!$ENV{PG_TEST_EXTRA} || $ENV{PG_TEST_EXTRA} !~ /\bperf\b/)
+{
+	plan skip_all => "test perf not enabled in PG_TEST_EXTRA";
+}
+
+# Multiplier for all data set sizes
+my $scale = $ENV{PG_PERF_SCALE} // 1;
+# Allowed slowdown relative to the baseline, as a fraction
+my $tolerance = $ENV{PG_PERF_TOLERANCE} // 0.2;
+my $baseline_file = $ENV{PG_PERF_BASELINE};
+my $result_file = "$PostgreSQL::Test::Utils::tmp_check/perf_results.json";
+
+my $sort_rows = int(10_000_000 * $scale);
+my @hashjoin_sizes = map { int($_ * $scale) } (10_000, 1_000_000, 5_000_000);
+my $copy_rows = int(5_000_000 * $scale);
+my $pgbench_scale = int(10 * $scale) || 1;
+my $pgbench_xacts = int(10_000 * $scale) || 1;
+
+my $node = PostgreSQL::Test::Cluster->new('main');
+$node->init;
+
+# Keep the setup stable across runs: no background activity competing with
+# the workloads, and no parallel query, whose worker count depends on the
+# machine.
+$node->append_conf(
+	'postgresql.conf', qq{
+autovacuum = off
+max_parallel_workers_per_gather = 0
+shared_buffers = 256MB
+max_wal_size = 8GB
+checkpoint_timeout = 1h
+track_io_timing = on
+});
+$node->start;
+
+# Counters summed over all client backends.  Workloads are run in a single
+# session each, and forcing a flush makes its counts visible right away.
+my $counters_query = q{
+SELECT sum(reads), sum(read_bytes), sum(writes), sum(write_bytes),
+       sum(extends), sum(extend_bytes), sum(hits),
+       (SELECT wal_records FROM pg_stat_wal),
+       (SELECT wal_bytes FROM pg_stat_wal)
+FROM pg_stat_io WHERE backend_type = 'client backend'};
+my @counter_names = qw(reads read_bytes writes write_bytes extends
+  extend_bytes hits wal_records wal_bytes);
+
+sub get_counters
+{
+	my @vals = split /\|/, $node->safe_psql('postgres', $counters_query);
+	my %counters;
+
+	@counters{@counter_names} = map { $_ eq '' ? 0 : $_ + 0 } @vals;
+	return \%counters;
+}
+
+my %results;
+
+# Run one workload and record its elapsed time and counter deltas.  $code
+# does the actual work, so that non-SQL workloads such as pgbench can be
+# measured the same way.
+sub measure
+{
+	my ($name, $code) = @_;
+
+	$node->safe_psql('postgres', 'CHECKPOINT');
+	my $before = get_counters();
+	my $start = time();
+	$code->();
+	my $elapsed = time() - $start;
+	my $after = get_counters();
+
+	my %entry = (wall_time_s => sprintf('%.3f', $elapsed) + 0);
+	$entry{$_} = $after->{$_} - $before->{$_} foreach @counter_names;
+	$results{$name} = \%entry;
+
+	note sprintf('%s: %.3f s', $name, $elapsed);
+	pass("workload $name");
+}
+
+sub measure_sql
+{
+	my ($name, $sql) = @_;
+
+	measure($name,
+		sub {
+			$node->safe_psql('postgres',
+				"$sql; SELECT pg_stat_force_next_flush();");
+		});
+}
+
+# Sort, spilling to disk with the default work_mem
+$node->safe_psql(
+	'postgres', qq{
+CREATE TABLE perf_sort AS
+  SELECT (random() * 1e9)::int8 AS k, md5(i::text) AS v
+  FROM generate_series(1, $sort_rows) i;
+VACUUM ANALYZE perf_sort;
+});
+measure_sql('sort',
+	"SELECT * FROM perf_sort ORDER BY k, v OFFSET $sort_rows");
+
+# Hash join with inner sides fitting easily in work_mem, needing a few
+# batches, and needing many batches
+foreach my $size (@hashjoin_sizes)
+{
+	$node->safe_psql(
+		'postgres', qq{
+CREATE TABLE perf_hj_$size AS
+  SELECT i AS id, md5(i::text) AS v FROM generate_series(0, $size - 1) i;
+VACUUM ANALYZE perf_hj_$size;
+});
+	measure_sql(
+		"hashjoin_$size", qq{
+SET enable_mergejoin = off;
+SET enable_nestloop = off;
+SELECT count(*) FROM perf_sort o JOIN perf_hj_$size i ON i.id = o.k % $size});
+}
+
+# COPY FROM a CSV file
+my $csv_file = $node->basedir . '/perf_copy.csv';
+$node->safe_psql(
+	'postgres', qq{
+COPY (SELECT i, md5(i::text), now() FROM generate_series(1, $copy_rows) i)
+  TO '$csv_file' (FORMAT csv);
+CREATE TABLE perf_copy (id int8, v text, ts timestamptz);
+});
+measure_sql('copy_from_csv',
+	"COPY perf_copy FROM '$csv_file' (FORMAT csv)");
+
+# VACUUM of a table with most of its rows deleted
+$node->safe_psql(
+	'postgres', qq{
+CREATE INDEX ON perf_copy (id);
+DELETE FROM perf_copy WHERE id % 10 <> 0;
+});
+measure_sql('vacuum_bloated', 'VACUUM perf_copy');
+
+# pgbench's TPC-B-like and read-only mixes
+$node->command_ok(
+	[
+		'pgbench', '--initialize', '--quiet',
+		'--scale' => $pgbench_scale,
+		'--dbname' => $node->connstr('postgres'),
+	],
+	'pgbench initialization');
+foreach my $mix (
+	[ 'pgbench_tpcb', 'tpcb-like' ],
+	[ 'pgbench_select', 'select-only' ])
+{
+	my ($name, $builtin) = @$mix;
+
+	measure(
+		$name,
+		sub {
+			$node->command_ok(
+				[
+					'pgbench', '--no-vacuum',
+					'--builtin' => $builtin,
+					'--client' => 4,
+					'--jobs' => 4,
+					'--transactions' => $pgbench_xacts,
+					'--dbname' => $node->connstr('postgres'),
+				],
+				"pgbench $builtin");
+			# pgbench's sessions flush their counters when they exit
+			$node->poll_query_until('postgres',
+				"SELECT count(*) = 1 FROM pg_stat_activity WHERE backend_type = 'client backend'"
+			);
+		});
+}
+
+$node->stop;
+
+# Write the results, sorted so that two runs are easy to diff
+my $json = JSON::PP->new->canonical->pretty;
+my %output = (
+	version => "" . $node->pg_version,
+	scale => $scale + 0,
+	workloads => \%results);
+open(my $fh, '>', $result_file) or die "could not open $result_file: $!";
+print $fh $json->encode(\%output);
+close($fh);
+note "results written to $result_file";
+
+if ($baseline_file)
+{
+	my $baseline = decode_json(slurp_file($baseline_file));
+
+	foreach my $name (sort keys %results)
+	{
+		my $base = $baseline->{workloads}{$name};
+
+		next unless $base && $base->{wall_time_s} > 0;
+
+		my $ratio = $results{$name}{wall_time_s} / $base->{wall_time_s};
+		ok($ratio <= 1 + $tolerance,
+			sprintf('%s: %.3f s vs. baseline %.3f s (%+.1f%%)',
+				$name, $results{$name}{wall_time_s},
+				$base->{wall_time_s}, ($ratio - 1) * 100));
+	}
+}
+
+done_testing();
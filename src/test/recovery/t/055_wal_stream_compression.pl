@@ -0,0 +1,96 @@
+# Copyright (c) 2026, PostgreSQL Global Development Group
+
+# Test streaming of compressed WAL, including across a timeline switch,
+# where the WAL receiver issues a new START_REPLICATION on the same
+# connection.
+use strict;
+use warnings FATAL => 'all';
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+
+if (!check_pg_config("#define USE_LZ4 1"))
+{
+	plan skip_all => 'lz4 not supported by this build';
+}
+
+# Initialize primary node
+my $node_primary = PostgreSQL::Test::Cluster->new('primary');
+$node_primary->init(allows_streaming => 1);
+$node_primary->start;
+
+my $backup_name = 'my_backup';
+$node_primary->backup($backup_name);
+
+# Create two standbys asking for compressed WAL
+my $node_standby_1 = PostgreSQL::Test::Cluster->new('standby_1');
+$node_standby_1->init_from_backup($node_primary, $backup_name,
+	has_streaming => 1);
+$node_standby_1->append_conf(
+	'postgresql.conf', qq(
+wal_receiver_compression = lz4
+log_replication_commands = on
+));
+$node_standby_1->start;
+my $node_standby_2 = PostgreSQL::Test::Cluster->new('standby_2');
+$node_standby_2->init_from_backup($node_primary, $backup_name,
+	has_streaming => 1);
+$node_standby_2->append_conf(
+	'postgresql.conf', qq(
+wal_receiver_compression = lz4
+));
+$node_standby_2->start;
+
+$node_primary->poll_query_until('postgres',
+	"SELECT count(1) = 2 FROM pg_stat_replication");
+
+# Create some easily compressible content on primary
+$node_primary->safe_psql('postgres',
+	"CREATE TABLE tab_int AS SELECT generate_series(1,10000) AS a, repeat('x', 100) AS b"
+);
+$node_primary->wait_for_catchup($node_standby_1);
+$node_primary->wait_for_catchup($node_standby_2);
+
+my $result =
+  $node_standby_1->safe_psql('postgres', "SELECT count(*) FROM tab_int");
+is($result, qq(10000), 'compressed WAL streamed to standby 1');
+
+# Stop the primary and promote standby 1, switching it to a new timeline
+$node_primary->stop;
+$node_standby_1->promote;
+
+# Switch standby 2 to replay from standby 1.  Its WAL receiver starts on
+# the old timeline, and then issues a second START_REPLICATION for the new
+# timeline on the same connection.
+my $connstr_1 = $node_standby_1->connstr;
+$node_standby_2->append_conf(
+	'postgresql.conf', qq(
+primary_conninfo='$connstr_1'
+));
+$node_standby_2->restart;
+
+$node_standby_2->poll_query_until('postgres',
+	"SELECT EXISTS(SELECT 1 FROM pg_stat_wal_receiver)");
+my $wr_pid_before_switch = $node_standby_2->safe_psql('postgres',
+	"SELECT pid FROM pg_stat_wal_receiver");
+
+$node_standby_1->safe_psql('postgres',
+	"INSERT INTO tab_int SELECT generate_series(10001,20000), repeat('y', 100)"
+);
+$node_standby_1->wait_for_catchup($node_standby_2);
+
+$result =
+  $node_standby_2->safe_psql('postgres', "SELECT count(*) FROM tab_int");
+is($result, qq(20000), 'compressed WAL streamed across timeline switch');
+
+my $wr_pid_after_switch = $node_standby_2->safe_psql('postgres',
+	"SELECT pid FROM pg_stat_wal_receiver");
+is($wr_pid_before_switch, $wr_pid_after_switch,
+	'WAL receiver PID matches across timeline jumps');
+
+ok( $node_standby_1->log_contains(
+		"received replication command: START_REPLICATION .* TIMELINE 2 \\(compression 'lz4'\\)"
+	),
+	'compression requested again on the new timeline');
+
+done_testing();
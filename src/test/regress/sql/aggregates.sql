@@ -994,6 +994,36 @@ reset parallel_setup_cost;
 drop view v_pagg_test;
 drop table pagg_test;
 
+-- Test approx_count_distinct
+select approx_count_distinct(x) from (values (1), (2), (2), (3), (null)) v(x);
+select approx_count_distinct(x) from (values (null::int), (null)) v(x);
+select approx_count_distinct(unique1) from tenk1 where unique1 < 0;
+
+-- the standard error is about 1.6%, so allow for a few times that
+select n, abs(approx_count_distinct(g) - n) <= n * 0.05 as close_enough
+  from (values (1000), (10000), (100000)) v(n), generate_series(1, n) g
+  group by n order by n;
+select abs(approx_count_distinct(g % 1000) - 1000) <= 50 as close_enough
+  from generate_series(1, 100000) g;
+select approx_count_distinct(x collate "C") from (values ('abc'), ('ABC'), ('abc')) v(x);
+
+-- error, no hash function
+select approx_count_distinct(p) from (values (point '(1,2)')) v(p);
+
+-- partial aggregation must combine the worker states correctly
+begin;
+alter table tenk1 set (parallel_workers = 4);
+set local parallel_setup_cost = 0;
+set local max_parallel_workers_per_gather = 4;
+explain (costs off)
+  select approx_count_distinct(hundred) from tenk1;
+select approx_count_distinct(hundred) as parallel_estimate from tenk1 \gset
+select :parallel_estimate between 95 and 105 as close_enough;
+set local max_parallel_workers_per_gather = 0;
+select approx_count_distinct(hundred) = :parallel_estimate as same_estimate
+  from tenk1;
+rollback;
+
 -- FILTER tests
 
 select min(unique1) filter (where unique1 > 100) from tenk1;
@@ -1774,3 +1804,49 @@ drop table agg_hash_1;
 drop table agg_hash_2;
 drop table agg_hash_3;
 drop table agg_hash_4;
+
+--
+-- A Partial HashAggregate that runs out of memory emits the groups it has
+-- collected instead of spilling them, and the Finalize step combines them.
+-- Compare the results of such a plan with those of a serial plan.  Group by
+-- a plain column, so that the planner knows how few groups there are and
+-- chooses partial aggregation.
+--
+
+create table agg_data_100k as
+select g, g % 5000 as k from generate_series(0, 99999) g;
+analyze agg_data_100k;
+
+begin;
+set local parallel_setup_cost = 0;
+set local min_parallel_table_scan_size = 0;
+set local max_parallel_workers_per_gather = 2;
+set local enable_groupagg = false;
+set local work_mem = '64kB';
+
+explain (costs off)
+create table agg_hash_parallel as
+select k as c1, sum(g::numeric) as c2, count(*) as c3
+  from agg_data_100k group by k;
+create table agg_hash_parallel as
+select k as c1, sum(g::numeric) as c2, count(*) as c3
+  from agg_data_100k group by k;
+
+set local max_parallel_workers_per_gather = 0;
+
+explain (costs off)
+create table agg_hash_serial as
+select k as c1, sum(g::numeric) as c2, count(*) as c3
+  from agg_data_100k group by k;
+create table agg_hash_serial as
+select k as c1, sum(g::numeric) as c2, count(*) as c3
+  from agg_data_100k group by k;
+commit;
+
+(select * from agg_hash_parallel except select * from agg_hash_serial)
+  union all
+(select * from agg_hash_serial except select * from agg_hash_parallel);
+
+drop table agg_data_100k;
+drop table agg_hash_parallel;
+drop table agg_hash_serial;
@@ -610,6 +610,7 @@ SELECT x FROM test2cs EXCEPT SELECT x FROM test1cs;
 SELECT DISTINCT x FROM test3cs ORDER BY x;
 RESET enable_hashagg;
 SELECT count(DISTINCT x) FROM test3cs;
+SELECT approx_count_distinct(x) FROM test3cs;
 SELECT x, count(*) FROM test3cs GROUP BY x ORDER BY x;
 SELECT x, row_number() OVER (ORDER BY x), rank() OVER (ORDER BY x) FROM test3cs ORDER BY x;
 CREATE UNIQUE INDEX ON test1cs (x);  -- ok
@@ -743,6 +744,7 @@ SELECT x FROM test1ci EXCEPT SELECT x FROM test2ci;
 SELECT x FROM test2ci EXCEPT SELECT x FROM test1ci;
 SELECT DISTINCT x FROM test3ci ORDER BY x;
 SELECT count(DISTINCT x) FROM test3ci;
+SELECT approx_count_distinct(x) FROM test3ci;
 SELECT x, count(*) FROM test3ci GROUP BY x ORDER BY x;
 SELECT x, row_number() OVER (ORDER BY x), rank() OVER (ORDER BY x) FROM test3ci ORDER BY x;
 CREATE UNIQUE INDEX ON test1ci (x);  -- ok
@@ -0,0 +1,74 @@
+-- Tests for TOAST compression with zstd
+
+SELECT NOT(enumvals @> '{zstd}') AS skip_test FROM pg_settings WHERE
+  name = 'default_toast_compression' \gset
+\if :skip_test
+   \echo '*** skipping TOAST tests with zstd (not supported) ***'
+   \quit
+\endif
+
+CREATE SCHEMA zstd;
+SET search_path TO zstd, public;
+
+-- Ensure we get stable results regardless of the installation's default.
+SET default_toast_compression = 'pglz';
+
+-- test creating table with compression method
+CREATE TABLE cmdata_zstd(f1 TEXT COMPRESSION zstd);
+INSERT INTO cmdata_zstd VALUES(repeat('1234567890', 1004));
+SELECT attcompression FROM pg_attribute
+  WHERE attrelid = 'cmdata_zstd'::regclass AND attname = 'f1';
+
+-- verify stored compression method in the data
+SELECT pg_column_compression(f1) FROM cmdata_zstd;
+
+-- decompress data slice
+SELECT SUBSTR(f1, 2000, 50) FROM cmdata_zstd;
+
+-- copy with table creation
+SELECT * INTO cmmove1 FROM cmdata_zstd;
+SELECT pg_column_compression(f1) FROM cmmove1;
+
+-- update using datum from different table with zstd data.
+CREATE TABLE cmmove2(f1 text COMPRESSION pglz);
+INSERT INTO cmmove2 VALUES (repeat('1234567890', 1004));
+SELECT pg_column_compression(f1) FROM cmmove2;
+UPDATE cmmove2 SET f1 = cmdata_zstd.f1 FROM cmdata_zstd;
+SELECT pg_column_compression(f1) FROM cmmove2;
+
+-- test externally stored compressed data
+CREATE OR REPLACE FUNCTION large_val_zstd() RETURNS TEXT LANGUAGE SQL AS
+'select array_agg(fipshash(g::text))::text from generate_series(1, 256) g';
+CREATE TABLE cmdata2 (f1 text COMPRESSION zstd);
+INSERT INTO cmdata2 SELECT large_val_zstd() || repeat('a', 4000);
+SELECT pg_column_compression(f1) FROM cmdata2;
+SELECT SUBSTR(f1, 200, 5) FROM cmdata2;
+DROP TABLE cmdata2;
+DROP FUNCTION large_val_zstd;
+
+-- test alter compression method, and back again
+CREATE TABLE cmdata_pglz(f1 text COMPRESSION pglz);
+INSERT INTO cmdata_pglz VALUES (repeat('1234567890', 1000));
+ALTER TABLE cmdata_pglz ALTER COLUMN f1 SET COMPRESSION zstd;
+SELECT attcompression FROM pg_attribute
+  WHERE attrelid = 'cmdata_pglz'::regclass AND attname = 'f1';
+INSERT INTO cmdata_pglz VALUES (repeat('123456789', 4004));
+ALTER TABLE cmdata_pglz ALTER COLUMN f1 SET COMPRESSION pglz;
+SELECT attcompression FROM pg_attribute
+  WHERE attrelid = 'cmdata_pglz'::regclass AND attname = 'f1';
+INSERT INTO cmdata_pglz VALUES (repeat('12345678', 4004));
+SELECT pg_column_compression(f1), SUBSTR(f1, 1000, 10) FROM cmdata_pglz;
+
+-- test default_toast_compression GUC
+SET default_toast_compression = 'zstd';
+CREATE TABLE cmdata_default(f1 text);
+INSERT INTO cmdata_default VALUES (repeat('1234567890', 1004));
+SELECT pg_column_compression(f1) FROM cmdata_default;
+RESET default_toast_compression;
+
+-- check data is ok
+SELECT length(f1) FROM cmdata_zstd;
+SELECT length(f1) FROM cmmove1;
+SELECT length(f1) FROM cmmove2;
+SELECT length(f1) FROM cmdata_pglz;
+SELECT length(f1) FROM cmdata_default;
@@ -199,6 +199,14 @@ SELECT pg_input_is_valid('garbage', 'date');
 SELECT pg_input_is_valid('6874898-01-01', 'date');
 SELECT * FROM pg_input_error_info('garbage', 'date');
 SELECT * FROM pg_input_error_info('6874898-01-01', 'date');
+-- Input close to the canonical ISO 8601 form must give the same results
+-- as before the fast path for that form was added
+SELECT pg_input_is_valid('2024-01-01-05', 'date');
+SELECT date '2024-01-01T10:00:00' = date '2024-01-01';
+SELECT date '2024-01-01 10:00:00.1234567' = date '2024-01-01';
+SELECT date '2024-01-01 24:00:00' = date '2024-01-01';
+SELECT date '2024-01-01 23:59:60' = date '2024-01-01';
+SELECT pg_input_is_valid('0000-01-01', 'date');
 
 RESET datestyle;
 
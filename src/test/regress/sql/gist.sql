@@ -127,6 +127,53 @@ order by point(5.2, 5.91) <-> b;
 
 drop index gist_tbl_box_index;
 
+-- Test a parallel sorted build.  point_ops has a sortsupport function, so
+-- the index can be built with parallel workers; the results must be the same
+-- as with the serial build above.  box_ops has no sortsupport function, and
+-- with buffering forced on point_ops isn't sorted either, so those indexes
+-- are built serially.  The DEBUG1 messages show how many workers were
+-- requested.
+begin;
+set local max_parallel_maintenance_workers = 2;
+set local min_parallel_table_scan_size = 0;
+set local maintenance_work_mem = '128MB';
+set local log_temp_files = -1;
+set local log_statement = none;
+set local client_min_messages = debug1;
+create index gist_tbl_point_index on gist_tbl using gist (p);
+create index gist_tbl_box_index on gist_tbl using gist (b);
+reset client_min_messages;
+create index gist_tbl_point_buffered_index on gist_tbl using gist (p) with (buffering = on);
+commit;
+drop index gist_tbl_box_index;
+drop index gist_tbl_point_buffered_index;
+
+explain (costs off)
+select p from gist_tbl where p <@ box(point(0,0), point(0.5, 0.5))
+order by p <-> point(0.201, 0.201);
+
+select p from gist_tbl where p <@ box(point(0,0), point(0.5, 0.5))
+order by p <-> point(0.201, 0.201);
+
+select count(*) from gist_tbl where p <@ box(point(0,0), point(1000,1000));
+
+-- Test a parallel index-only scan.  KNN scans are never parallel, but a
+-- plain qualified scan can be divided among the workers.  Use <<, whose
+-- selectivity estimate is large enough for the parallel plan to win clearly;
+-- <@ is estimated to return too few rows for that.
+begin;
+set local parallel_setup_cost = 0;
+set local parallel_tuple_cost = 0;
+set local min_parallel_index_scan_size = 0;
+set local max_parallel_workers_per_gather = 2;
+explain (costs off)
+select count(*) from gist_tbl where p << point(100,100);
+select count(*), min(p[0]), max(p[0])
+from gist_tbl where p << point(100,100);
+commit;
+
+drop index gist_tbl_point_index;
+
 -- Test that an index-only scan is not chosen, when the query involves the
 -- circle column (the circle opclass does not support index-only scans).
 create index gist_tbl_multi_index on gist_tbl using gist (p, c);
@@ -386,6 +386,24 @@ select count(*) from tenk1 x where
   x.unique1 in (select aa.f1 from int4_tbl aa,float8_tbl bb where aa.f1=bb.f1);
 rollback;
 
+-- and with the greedy join search, which is deterministic
+begin;
+set geqo = on;
+set geqo_threshold = 2;
+set geqo_strategy = greedy;
+select count(*) from tenk1 x where
+  x.unique1 in (select a.f1 from int4_tbl a,float8_tbl b where a.f1=b.f1) and
+  x.unique1 = 0 and
+  x.unique1 in (select aa.f1 from int4_tbl aa,float8_tbl bb where aa.f1=bb.f1);
+explain (costs off)
+select a.stringu1, b.stringu1
+  from tenk1 a join tenk1 b on a.unique2 = b.unique1
+  join int4_tbl c on a.unique1 = c.f1;
+select count(*)
+  from tenk1 a join tenk1 b on a.unique2 = b.unique1
+  join int4_tbl c on a.unique1 = c.f1;
+rollback;
+
 --
 -- regression test: be sure we cope with proven-dummy append rels
 --
@@ -192,6 +192,64 @@ $$);
 select count(*) from simple r full outer join simple s using (id);
 rollback to settings;
 
+-- A multi-batch join whose outer tuples can be dropped when they have
+-- no match summarizes the inner hash values in a Bloom filter, so that
+-- such tuples never reach a batch file.  The filter is charged against
+-- hash_mem and only built if a quarter of the budget can hold it.
+create or replace function hash_join_bloom(query text)
+returns table (memory int, removed bigint) language plpgsql
+as
+$$
+declare
+  whole_plan json;
+  hash_node json;
+begin
+  for whole_plan in
+    execute 'explain (analyze, format ''json'') ' || query
+  loop
+    hash_node := find_hash(json_extract_path(whole_plan, '0', 'Plan'));
+    memory := hash_node->>'Bloom Filter Memory Usage';
+    removed := hash_node->>'Outer Rows Removed by Bloom Filter';
+    return next;
+  end loop;
+end;
+$$;
+
+savepoint settings;
+set local max_parallel_workers_per_gather = 0;
+set local work_mem = '4MB';
+set local hash_mem_multiplier = 1.0;
+create table bloom_r as select generate_series(1, 150000) as id;
+create table bloom_s as select generate_series(75001, 225000) as id;
+analyze bloom_r, bloom_s;
+select count(*) from bloom_r r join bloom_s s using (id);
+select original > 1 as initially_multibatch
+  from hash_join_batches(
+$$
+  select count(*) from bloom_r r join bloom_s s using (id);
+$$);
+select memory >= 1024 as bloom_filter, removed > 0 as removed_rows
+  from hash_join_bloom(
+$$
+  select count(*) from bloom_r r join bloom_s s using (id);
+$$);
+-- outer tuples that must be null-extended are not filtered
+select count(*) from bloom_r r left join bloom_s s using (id);
+select count(*) from bloom_r r right join bloom_s s using (id);
+-- no filter if it won't fit in the budget, or if there's only one batch
+select memory is null as no_bloom_filter
+  from hash_join_bloom(
+$$
+  select count(*) from simple r join simple s using (id);
+$$);
+set local work_mem = '128kB';
+select memory is null as no_bloom_filter
+  from hash_join_bloom(
+$$
+  select count(*) from simple r join simple s using (id);
+$$);
+rollback to settings;
+
 -- The "bad" case: during execution we need to increase number of
 -- batches; in this case we plan for 1 batch, and increase at least a
 -- couple of times, and peak memory usage stays within our work_mem
@@ -132,6 +132,17 @@ SELECT pg_input_is_valid('garbage', 'timestamptz');
 SELECT pg_input_is_valid('2001-01-01 00:00 Nehwon/Lankhmar', 'timestamptz');
 SELECT * FROM pg_input_error_info('garbage', 'timestamptz');
 SELECT * FROM pg_input_error_info('2001-01-01 00:00 Nehwon/Lankhmar', 'timestamptz');
+-- Input close to the canonical ISO 8601 form must give the same results
+-- as before the fast path for that form was added
+SELECT pg_input_is_valid('2024-01-01-05', 'timestamptz');
+SELECT timestamptz '2024-01-01 10:00:00-05' = timestamptz '2024-01-01 15:00:00 UTC';
+SELECT timestamptz '2024-01-01T10:00:00+05:30' = timestamptz '2024-01-01 04:30:00 UTC';
+SELECT timestamptz '2024-01-01 10:00:00+0530' = timestamptz '2024-01-01 04:30:00 UTC';
+SELECT timestamptz '2024-01-01 10:00:00.1234567+00' = timestamptz '2024-01-01 10:00:00.123457 UTC';
+SELECT timestamptz '2024-01-01 24:00:00+00' = timestamptz '2024-01-02 00:00:00 UTC';
+SELECT timestamptz '2024-01-01 23:59:60+00' = timestamptz '2024-01-02 00:00:00 UTC';
+SELECT pg_input_is_valid('0000-01-01 00:00:00+00', 'timestamptz');
+SELECT pg_input_is_valid('2024-01-01 10:00:00+16', 'timestamptz');
 
 -- Check date conversion and date arithmetic
 INSERT INTO TIMESTAMPTZ_TBL VALUES ('1997-06-10 18:32:01 PDT');
@@ -0,0 +1,98 @@
+# Copyright (c) 2026, PostgreSQL Global Development Group
+
+# Test that filtering changes by relation while decoding doesn't lose
+# changes to relations that are added to a publication concurrently, or by
+# the decoded transaction itself.
+use strict;
+use warnings FATAL => 'all';
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+
+# Initialize publisher node
+my $node_publisher = PostgreSQL::Test::Cluster->new('publisher');
+$node_publisher->init(allows_streaming => 'logical');
+$node_publisher->start;
+
+# Initialize subscriber node
+my $node_subscriber = PostgreSQL::Test::Cluster->new('subscriber');
+$node_subscriber->init;
+$node_subscriber->start;
+
+my $publisher_connstr = $node_publisher->connstr . ' dbname=postgres';
+
+# tab_b and tab_c are only in a publication that publishes truncates, so
+# that they are part of the subscription from the start, but their inserts
+# are filtered while decoding until they are added to tap_pub.
+$node_publisher->safe_psql(
+	'postgres', qq(
+	CREATE TABLE tab_a (a int);
+	CREATE TABLE tab_b (a int);
+	CREATE TABLE tab_c (a int);
+	CREATE PUBLICATION tap_pub FOR TABLE tab_a WITH (publish = 'insert');
+	CREATE PUBLICATION tap_pub_trunc FOR TABLE tab_b, tab_c WITH (publish = 'truncate');
+));
+$node_subscriber->safe_psql(
+	'postgres', qq(
+	CREATE TABLE tab_a (a int);
+	CREATE TABLE tab_b (a int);
+	CREATE TABLE tab_c (a int);
+	CREATE SUBSCRIPTION tap_sub CONNECTION '$publisher_connstr' PUBLICATION tap_pub, tap_pub_trunc;
+));
+$node_subscriber->wait_for_subscription_sync($node_publisher, 'tap_sub');
+
+$node_publisher->safe_psql(
+	'postgres', qq(
+	INSERT INTO tab_a VALUES (1);
+	INSERT INTO tab_b VALUES (1);
+	INSERT INTO tab_c VALUES (1);
+));
+$node_publisher->wait_for_catchup('tap_sub');
+
+my $result = $node_subscriber->safe_psql('postgres',
+	'SELECT (SELECT count(*) FROM tab_a), (SELECT count(*) FROM tab_b), (SELECT count(*) FROM tab_c)'
+);
+is($result, '1|0|0', 'inserts are only replicated for published tables');
+
+# A transaction inserts into tab_b before and after another transaction adds
+# it to the publication.  The decision made for the first insert must not
+# be reused for the second one.
+my $h = $node_publisher->background_psql('postgres', on_error_stop => 0);
+$h->query_safe('BEGIN');
+$h->query_safe('INSERT INTO tab_b VALUES (2)');
+
+$node_publisher->safe_psql('postgres',
+	'ALTER PUBLICATION tap_pub ADD TABLE tab_b');
+
+$h->query_safe('INSERT INTO tab_b VALUES (3)');
+$h->query_safe('COMMIT');
+
+$node_publisher->safe_psql('postgres', 'INSERT INTO tab_b VALUES (4)');
+
+$node_publisher->wait_for_catchup('tap_sub');
+
+$result =
+  $node_subscriber->safe_psql('postgres', 'SELECT a FROM tab_b ORDER BY a');
+is( $result, qq(3
+4),
+	'changes made after a concurrent ADD TABLE are replicated');
+
+# A transaction that adds tab_c to the publication itself and then inserts
+# into it.
+$h->query_safe('BEGIN');
+$h->query_safe('ALTER PUBLICATION tap_pub ADD TABLE tab_c');
+$h->query_safe('INSERT INTO tab_c VALUES (2)');
+$h->query_safe('COMMIT');
+$h->quit;
+
+$node_publisher->wait_for_catchup('tap_sub');
+
+$result =
+  $node_subscriber->safe_psql('postgres', 'SELECT a FROM tab_c ORDER BY a');
+is($result, '2',
+	'changes made after ADD TABLE in the same transaction are replicated');
+
+$node_subscriber->stop('fast');
+$node_publisher->stop('fast');
+
+done_testing();